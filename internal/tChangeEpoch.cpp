@@ -0,0 +1,193 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tChangeEpoch.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tChangeEpoch.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tLock.h"
+#include <algorithm>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tChangeEpoch::tChangeEpoch() :
+  counter(0),
+  update_depth(0),
+  updating_thread(std::thread::id()),
+  listener_mutex(),
+  listeners()
+{}
+
+void tChangeEpoch::AddListener(tListener& listener)
+{
+  std::lock_guard<std::mutex> lock(listener_mutex);
+  listeners.push_back(&listener);
+}
+
+tChangeEpoch* tChangeEpoch::Find(const core::tFrameworkElement& element)
+{
+  for (const core::tFrameworkElement* current = &element; current; current = current->GetParent())
+  {
+    tChangeEpoch* epoch = current->GetAnnotation<tChangeEpoch>();
+    if (epoch)
+    {
+      return epoch;
+    }
+  }
+  return nullptr;
+}
+
+tChangeEpoch* tChangeEpoch::GetParentEpoch() const
+{
+  core::tFrameworkElement* element = GetAnnotated<core::tFrameworkElement>();
+  core::tFrameworkElement* parent = element ? element->GetParent() : nullptr;
+  return parent ? Find(*parent) : nullptr;
+}
+
+tChangeEpoch& tChangeEpoch::GetOrCreate(core::tFrameworkElement& element)
+{
+  rrlib::thread::tLock lock(element.GetStructureMutex());
+  tChangeEpoch* epoch = element.GetAnnotation<tChangeEpoch>();
+  if (!epoch)
+  {
+    epoch = new tChangeEpoch();
+    element.AddAnnotation(*epoch);
+  }
+  return *epoch;
+}
+
+std::recursive_mutex& tChangeEpoch::GetUpdateMutex()
+{
+  static std::recursive_mutex update_mutex;
+  return update_mutex;
+}
+
+void tChangeEpoch::RemoveListener(tListener& listener)
+{
+  std::lock_guard<std::mutex> lock(listener_mutex);
+  listeners.erase(std::remove(listeners.begin(), listeners.end(), &listener), listeners.end());
+}
+
+tChangeEpoch::tUpdate::tUpdate(std::vector<tChangeEpoch*> epochs) :
+  epochs(std::move(epochs))
+{
+  auto& list = this->epochs;
+  size_t given_epochs = list.size();
+  for (size_t i = 0; i < given_epochs; i++)
+  {
+    for (tChangeEpoch* ancestor = list[i] ? list[i]->GetParentEpoch() : nullptr; ancestor; ancestor = ancestor->GetParentEpoch())
+    {
+      list.push_back(ancestor);
+    }
+  }
+  list.erase(std::remove(list.begin(), list.end(), nullptr), list.end());
+  std::sort(list.begin(), list.end());
+  list.erase(std::unique(list.begin(), list.end()), list.end());
+
+  GetUpdateMutex().lock();
+  for (tChangeEpoch * epoch : list)
+  {
+    if (epoch->update_depth++ == 0)
+    {
+      epoch->updating_thread = std::this_thread::get_id();
+      epoch->counter++;
+    }
+  }
+}
+
+tChangeEpoch::tUpdate::~tUpdate()
+{
+  std::vector<std::pair<tChangeEpoch*, uint64_t>> completed;
+  for (auto it = epochs.rbegin(); it != epochs.rend(); ++it)
+  {
+    tChangeEpoch* epoch = *it;
+    if (--epoch->update_depth == 0)
+    {
+      uint64_t new_counter = ++epoch->counter;
+      epoch->updating_thread = std::thread::id();
+      completed.emplace_back(epoch, new_counter / 2);
+    }
+  }
+  GetUpdateMutex().unlock();
+
+  // notify listeners once per completed update (without holding any locks - so they may read parameters consistently)
+  for (auto & epoch : completed)
+  {
+    std::vector<tListener*> listeners;
+    {
+      std::lock_guard<std::mutex> lock(epoch.first->listener_mutex);
+      listeners = epoch.first->listeners;
+    }
+    for (tListener * listener : listeners)
+    {
+      listener->OnChangeEpoch(epoch.second);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
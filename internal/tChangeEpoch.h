@@ -0,0 +1,214 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tChangeEpoch.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tChangeEpoch
+ *
+ * \b tChangeEpoch
+ *
+ * Change epoch of the parameters below a framework element.
+ * It is a sequence counter that lets readers detect concurrent
+ * multi-parameter updates.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__parameters__internal__tChangeEpoch_h__
+#define __plugins__parameters__internal__tChangeEpoch_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "core/tFrameworkElement.h"
+#include "rrlib/util/tNoncopyable.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Change epoch of parameters
+/*!
+ * Annotates a framework element. Holds the change epoch of all parameters
+ * below it - including those in nested change epochs: updating a change epoch
+ * also updates all change epochs of its ancestors.
+ *
+ * The counter is odd while an update (tUpdate) is in progress.
+ * Readers can therefore read a consistent set of parameter values by
+ * re-reading until the counter is even and the same before and after
+ * reading (sequence lock).
+ *
+ * Listeners are notified once per update - after all values were published.
+ *
+ * All updates are serialized by a single (recursive) mutex. Therefore, nested
+ * updates - e.g. started by port listeners - cannot deadlock, regardless of which
+ * change epochs they affect.
+ */
+class tChangeEpoch : public core::tAnnotation
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * Listener that is notified once per update of a change epoch
+   * (by the updating thread - after the update is complete)
+   */
+  class tListener
+  {
+  public:
+    virtual ~tListener() {}
+
+    /*!
+     * \param change_epoch Change epoch after update (number of completed updates)
+     */
+    virtual void OnChangeEpoch(uint64_t change_epoch) = 0;
+  };
+
+  /*!
+   * Updates a set of change epochs - and the change epochs of their ancestors -
+   * for the lifetime of this object: their counters are odd until the object is destroyed.
+   * Updates may be nested by the same thread.
+   */
+  class tUpdate : private rrlib::util::tNoncopyable
+  {
+  public:
+    /*!
+     * \param epochs Change epochs to update (null entries and duplicates are ignored)
+     */
+    explicit tUpdate(std::vector<tChangeEpoch*> epochs);
+
+    ~tUpdate();
+
+  private:
+
+    /*! Change epochs being updated (including ancestors - without duplicates) */
+    std::vector<tChangeEpoch*> epochs;
+  };
+
+  tChangeEpoch();
+
+  /*!
+   * \param listener Listener to add (must be removed before it is deleted)
+   */
+  void AddListener(tListener& listener);
+
+  /*!
+   * \param element Framework element
+   * \return Change epoch of element's parameters. The element's own epoch, or the nearest one of its ancestors. Null if there is none.
+   *         (updates of the nearest epoch are also visible in the epochs of its ancestors)
+   */
+  static tChangeEpoch* Find(const core::tFrameworkElement& element);
+
+  /*!
+   * \return Current value of sequence counter (odd while an update is in progress)
+   */
+  uint64_t GetCounter() const
+  {
+    return counter.load();
+  }
+
+  /*!
+   * \param element Framework element
+   * \return Change epoch of element itself (created if it does not exist yet)
+   */
+  static tChangeEpoch& GetOrCreate(core::tFrameworkElement& element);
+
+  /*!
+   * \return Is an update in progress that was started by the current thread?
+   * (e.g. if a port listener is called while the thread publishes values of the update)
+   */
+  bool IsUpdatedByCurrentThread() const
+  {
+    return updating_thread.load() == std::this_thread::get_id();
+  }
+
+  /*!
+   * \param listener Listener to remove (notifications in progress by other threads may still call it)
+   */
+  void RemoveListener(tListener& listener);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Sequence counter */
+  std::atomic<uint64_t> counter;
+
+  /*! Nesting depth of current update (only the outer-most update changes counter - protected by GetUpdateMutex()) */
+  size_t update_depth;
+
+  /*! Thread performing current update (default-constructed id if none) */
+  std::atomic<std::thread::id> updating_thread;
+
+  /*! Mutex for listeners */
+  std::mutex listener_mutex;
+
+  /*! Listeners to notify after each update */
+  std::vector<tListener*> listeners;
+
+  /*!
+   * \return Nearest change epoch of an ancestor of the annotated element (null if there is none)
+   */
+  tChangeEpoch* GetParentEpoch() const;
+
+  /*!
+   * \return Mutex that serializes all updates. Recursive so that publishing a value may trigger nested updates.
+   */
+  static std::recursive_mutex& GetUpdateMutex();
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,120 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tCommandLineIndex.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tCommandLineIndex.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "core/tRuntimeEnvironment.h"
+#include "rrlib/thread/tLock.h"
+#include <unordered_map>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Command line options that parameters were bound to so far */
+struct tResolvedOptions
+{
+  /*! Mutex for resolved options */
+  rrlib::thread::tMutex mutex;
+
+  /*! Option name => value of command line argument (only found arguments; elements are never removed - so pointers to values remain valid) */
+  std::unordered_map<std::string, std::string> values;
+};
+
+/*!
+ * \return Command line options that parameters were bound to so far
+ */
+static tResolvedOptions& ResolvedOptions()
+{
+  static tResolvedOptions options;
+  return options;
+}
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+const std::string* tCommandLineIndex::Resolve(const std::string& option)
+{
+  if (option.empty())
+  {
+    return nullptr;
+  }
+
+  tResolvedOptions& options = ResolvedOptions();
+  rrlib::thread::tLock lock(options.mutex);
+  auto it = options.values.find(option);
+  if (it == options.values.end())
+  {
+    std::string value = core::tRuntimeEnvironment::GetInstance().GetCommandLineArgument(option);
+    if (value.empty())
+    {
+      return nullptr;  // not cached - argument may still be parsed
+    }
+    it = options.values.emplace(option, value).first;
+  }
+  return &it->second;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,101 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tCommandLineIndex.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tCommandLineIndex
+ *
+ * \b tCommandLineIndex
+ *
+ * Index of command line options that parameters are bound to.
+ * Each option is looked up in the runtime environment only once.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__parameters__internal__tCommandLineIndex_h__
+#define __plugins__parameters__internal__tCommandLineIndex_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <string>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Index of command line options
+/*!
+ * Parameters resolve the command line option they are bound to when their value is loaded.
+ * Once an argument was found, they keep a pointer to its value, so loading a parameter value
+ * (which happens again on every reload) requires no lookup at all.
+ *
+ * Found arguments are looked up in the runtime environment only once, as they do not change once
+ * command line parsing is complete. Options without argument are not cached - they are looked up
+ * again on the next load (options may be bound before command line parsing is complete).
+ */
+class tCommandLineIndex
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param option Name of command line option (may be empty)
+   * \return Value of command line argument. Null if option is empty or no argument is set for it (yet).
+   * The pointer remains valid until the program exits.
+   */
+  static const std::string* Resolve(const std::string& option);
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,339 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tCompiledConfig.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tCompiledConfig.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Header of compiled config file */
+struct tCompiledConfig::tHeader
+{
+  char magic[4];
+  uint32_t version;
+  uint32_t entry_count;
+  uint32_t data_size;
+
+  /*! Size and modification time of XML file that image was compiled from (all zero if unknown) */
+  uint64_t source_size;
+  int64_t source_mtime_sec;
+  int64_t source_mtime_nsec;
+};
+
+/*! Entry in entry table of compiled config file (offsets are relative to data area) */
+struct tCompiledConfig::tEntryRecord
+{
+  uint32_t name_offset;
+  uint32_t name_length;
+  uint32_t value_offset;
+  uint32_t value_length;
+  uint32_t flags;
+};
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+constexpr const char* tCompiledConfig::cFILE_EXTENSION;
+
+/*! Magic bytes at beginning of compiled config files */
+static const char cMAGIC[4] = { 'F', 'R', 'C', 'C' };
+
+/*! Version of file format */
+static const uint32_t cVERSION = 2;
+
+/*! Flag: value contains XML of value node */
+static const uint32_t cFLAG_XML_FRAGMENT = 1;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * Writes data to file (completely - retrying partial writes)
+ *
+ * \param fd File descriptor
+ * \param data Data to write
+ * \param size Size of data
+ * \return True if all data was written
+ */
+static bool WriteAll(int fd, const void* data, size_t size)
+{
+  const char* bytes = static_cast<const char*>(data);
+  while (size > 0)
+  {
+    ssize_t written = write(fd, bytes, size);
+    if (written < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    if (written <= 0)
+    {
+      return false;
+    }
+    bytes += written;
+    size -= written;
+  }
+  return true;
+}
+
+tCompiledConfig::tCompiledConfig(const std::string& file, bool require_private_file) :
+  image(nullptr),
+  image_size(0),
+  records(nullptr),
+  data(nullptr),
+  entry_count(0)
+{
+  int fd = open(file.c_str(), O_RDONLY | (require_private_file ? O_NOFOLLOW : 0));
+  if (fd < 0)
+  {
+    throw std::runtime_error("Could not open compiled config file '" + file + "'");
+  }
+  struct stat file_info;
+  if (fstat(fd, &file_info) != 0 || static_cast<size_t>(file_info.st_size) < sizeof(tHeader))
+  {
+    close(fd);
+    throw std::runtime_error("Invalid compiled config file '" + file + "'");
+  }
+  if (require_private_file && ((!S_ISREG(file_info.st_mode)) || file_info.st_uid != geteuid() || (file_info.st_mode & (S_IWGRP | S_IWOTH))))
+  {
+    close(fd);
+    throw std::runtime_error("Compiled config file '" + file + "' is not owned by this user or writable by others");
+  }
+  image_size = file_info.st_size;
+  image = mmap(nullptr, image_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (image == MAP_FAILED)
+  {
+    image = nullptr;
+    throw std::runtime_error("Could not map compiled config file '" + file + "'");
+  }
+
+  // Validate image
+  const tHeader* header = static_cast<const tHeader*>(image);
+  size_t table_size = header->entry_count * sizeof(tEntryRecord);
+  bool valid = memcmp(header->magic, cMAGIC, sizeof(cMAGIC)) == 0 && header->version == cVERSION &&
+               sizeof(tHeader) + table_size + header->data_size == image_size;
+  if (valid)
+  {
+    entry_count = header->entry_count;
+    records = reinterpret_cast<const tEntryRecord*>(static_cast<const char*>(image) + sizeof(tHeader));
+    data = static_cast<const char*>(image) + sizeof(tHeader) + table_size;
+    for (size_t i = 0; i < entry_count && valid; i++)
+    {
+      const tEntryRecord& record = records[i];
+      valid = static_cast<size_t>(record.name_offset) + record.name_length <= header->data_size &&
+              static_cast<size_t>(record.value_offset) + record.value_length <= header->data_size;
+    }
+  }
+  if (!valid)
+  {
+    munmap(image, image_size);
+    image = nullptr;
+    throw std::runtime_error("Invalid compiled config file '" + file + "'");
+  }
+}
+
+tCompiledConfig::~tCompiledConfig()
+{
+  if (image)
+  {
+    munmap(image, image_size);
+  }
+}
+
+bool tCompiledConfig::Find(const tConfigPath& entry, tValue& result) const
+{
+  const tEntryRecord* end = records + entry_count;
+  const tEntryRecord* it = std::lower_bound(records, end, entry, [this](const tEntryRecord & record, const tConfigPath & path)
+  {
+    return path.Compare(data + record.name_offset, record.name_length) > 0;
+  });
+  if (it == end || entry.Compare(data + it->name_offset, it->name_length) != 0)
+  {
+    return false;
+  }
+  result = GetValue(it - records);
+  return true;
+}
+
+std::string tCompiledConfig::GetName(size_t index) const
+{
+  assert(index < entry_count);
+  return std::string(data + records[index].name_offset, records[index].name_length);
+}
+
+tCompiledConfig::tValue tCompiledConfig::GetValue(size_t index) const
+{
+  assert(index < entry_count);
+  const tEntryRecord& record = records[index];
+  return tValue { data + record.value_offset, record.value_length, (record.flags & cFLAG_XML_FRAGMENT) != 0 };
+}
+
+bool tCompiledConfig::IsUpToDate(const std::string& compiled_file, const std::string& source_file)
+{
+  struct stat compiled_info, source_info;
+  if (stat(compiled_file.c_str(), &compiled_info) != 0)
+  {
+    return false;
+  }
+  if (stat(source_file.c_str(), &source_info) != 0)
+  {
+    return true;
+  }
+
+  tHeader header;
+  int fd = open(compiled_file.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+  bool header_read = read(fd, &header, sizeof(header)) == static_cast<ssize_t>(sizeof(header));
+  close(fd);
+  if ((!header_read) || memcmp(header.magic, cMAGIC, sizeof(cMAGIC)) != 0 || header.version != cVERSION)
+  {
+    return false;
+  }
+  if (header.source_size || header.source_mtime_sec || header.source_mtime_nsec)
+  {
+    // image records the exact state of the XML file it was compiled from
+    return header.source_size == static_cast<uint64_t>(source_info.st_size) && header.source_mtime_sec == static_cast<int64_t>(source_info.st_mtim.tv_sec) &&
+           header.source_mtime_nsec == static_cast<int64_t>(source_info.st_mtim.tv_nsec);
+  }
+
+  // source unknown: image must be strictly newer (with equal time stamps, XML file may have been modified after compiling)
+  return compiled_info.st_mtim.tv_sec > source_info.st_mtim.tv_sec ||
+         (compiled_info.st_mtim.tv_sec == source_info.st_mtim.tv_sec && compiled_info.st_mtim.tv_nsec > source_info.st_mtim.tv_nsec);
+}
+
+void tCompiledConfig::Write(const std::string& file, std::vector<tEntry>& entries, const std::string& source_file, unsigned int permissions)
+{
+  std::sort(entries.begin(), entries.end(), [](const tEntry & a, const tEntry & b)
+  {
+    return a.name < b.name;
+  });
+
+  std::vector<tEntryRecord> table;
+  table.reserve(entries.size());
+  size_t data_size = 0;
+  for (const tEntry & entry : entries)
+  {
+    tEntryRecord record;
+    record.name_offset = static_cast<uint32_t>(data_size);
+    record.name_length = static_cast<uint32_t>(entry.name.length());
+    record.value_offset = static_cast<uint32_t>(data_size + entry.name.length());
+    record.value_length = static_cast<uint32_t>(entry.value.length());
+    record.flags = entry.xml_fragment ? cFLAG_XML_FRAGMENT : 0;
+    table.push_back(record);
+    data_size += entry.name.length() + entry.value.length();
+  }
+  if (data_size > UINT32_MAX)
+  {
+    throw std::runtime_error("Config file is too large to be compiled");
+  }
+
+  tHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, cMAGIC, sizeof(cMAGIC));
+  header.version = cVERSION;
+  header.entry_count = static_cast<uint32_t>(entries.size());
+  header.data_size = static_cast<uint32_t>(data_size);
+  struct stat source_info;
+  if (source_file.length() && stat(source_file.c_str(), &source_info) == 0)
+  {
+    header.source_size = static_cast<uint64_t>(source_info.st_size);
+    header.source_mtime_sec = static_cast<int64_t>(source_info.st_mtim.tv_sec);
+    header.source_mtime_nsec = static_cast<int64_t>(source_info.st_mtim.tv_nsec);
+  }
+
+  // write image to temporary file and rename it (so that readers never see an incomplete image)
+  std::string temp_file = file + "." + std::to_string(getpid()) + ".tmp";
+  int fd = open(temp_file.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW, static_cast<mode_t>(permissions));
+  if (fd < 0)
+  {
+    throw std::runtime_error("Could not create compiled config file '" + temp_file + "': " + strerror(errno));
+  }
+  bool written = WriteAll(fd, &header, sizeof(header)) && WriteAll(fd, table.data(), table.size() * sizeof(tEntryRecord));
+  for (auto it = entries.begin(); it != entries.end() && written; ++it)
+  {
+    written = WriteAll(fd, it->name.data(), it->name.length()) && WriteAll(fd, it->value.data(), it->value.length());
+  }
+  written = written && fsync(fd) == 0;
+  written = (close(fd) == 0) && written;
+  if ((!written) || std::rename(temp_file.c_str(), file.c_str()) != 0)
+  {
+    std::string error = strerror(errno);
+    unlink(temp_file.c_str());
+    throw std::runtime_error("Failed writing compiled config file '" + file + "': " + error);
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
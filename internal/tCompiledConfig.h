@@ -0,0 +1,181 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tCompiledConfig.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tCompiledConfig
+ *
+ * \b tCompiledConfig
+ *
+ * Compiled (binary) image of a config file.
+ * Contains a table of all leaf entries - sorted by qualified name -
+ * followed by the entries' values.
+ * Images are memory-mapped and can be searched without parsing anything.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__parameters__internal__tCompiledConfig_h__
+#define __plugins__parameters__internal__tCompiledConfig_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tConfigBackend.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Compiled config file
+/*!
+ * Compiled (binary) image of a config file.
+ * Contains a table of all leaf entries - sorted by qualified name -
+ * followed by the entries' values.
+ * Images are memory-mapped and can be searched without parsing anything.
+ *
+ * Values are stored as text if the value node only contains text.
+ * Otherwise, the XML of the value node is stored.
+ * (binary encodings of values cannot be created offline, as config files do not contain any type information)
+ */
+class tCompiledConfig : public tConfigBackend
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! File extension of compiled config files (appended to name of XML file) */
+  static constexpr const char* cFILE_EXTENSION = ".compiled";
+
+  /*!
+   * \param file File name of compiled config file (memory-mapped)
+   * \param require_private_file Only accept a regular file (no symbolic link) that is owned by the effective user
+   *                             and not writable by group or others (for files in directories shared with other users)
+   *
+   * \throw Throws std::runtime_error if file cannot be opened, is no valid compiled config file, or does not meet requirements
+   */
+  tCompiledConfig(const std::string& file, bool require_private_file = false);
+
+  ~tCompiledConfig();
+
+  virtual bool Find(const tConfigPath& entry, tValue& result) const override;
+
+  virtual tKind GetKind() const override
+  {
+    return tKind::COMPILED;
+  }
+
+  /*!
+   * \param index Index of entry
+   * \return Qualified name of entry with specified index (entries are sorted by name)
+   */
+  virtual std::string GetName(size_t index) const override;
+
+  virtual tValue GetValue(size_t index) const override;
+
+  /*!
+   * \param compiled_file Compiled config file
+   * \param source_file XML file compiled config file was created from
+   * \return True if source file has not been modified since compiled config file was created from it
+   *         (compared with size and modification time of source file recorded in compiled config file -
+   *          or, if not recorded, compiled config file must be newer than source file)
+   */
+  static bool IsUpToDate(const std::string& compiled_file, const std::string& source_file);
+
+  /*!
+   * \return Number of entries in compiled config file
+   */
+  virtual size_t Size() const override
+  {
+    return entry_count;
+  }
+
+  /*!
+   * Writes compiled config file
+   * (written to temporary file that replaces file atomically - so readers never see an incomplete file)
+   *
+   * \param file File to write to
+   * \param entries Entries to write (sorted by name during call - names must be unique)
+   * \param source_file XML file that entries were loaded from (optional - its size and modification time are recorded for IsUpToDate())
+   * \param permissions Permissions of created file
+   *
+   * \throw Throws std::runtime_error if writing fails
+   */
+  static void Write(const std::string& file, std::vector<tEntry>& entries, const std::string& source_file = std::string(), unsigned int permissions = 0644);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  struct tHeader;
+  struct tEntryRecord;
+
+  /*! Memory-mapped image */
+  void* image;
+
+  /*! Size of memory-mapped image */
+  size_t image_size;
+
+  /*! Entry table in image */
+  const tEntryRecord* records;
+
+  /*! Data area in image (names and values) */
+  const char* data;
+
+  /*! Number of entries */
+  size_t entry_count;
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,121 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tConfigBackend.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tConfigBackend.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/serialization/serialization.h"
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tNumericValueParser.h"
+#include "plugins/parameters/internal/tValueEncoding.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+bool tConfigBackend::DeserializeEntry(const tConfigPath& entry, rrlib::rtti::tGenericObject& object) const
+{
+  tValue value;
+  if (!Find(entry, value))
+  {
+    return false;
+  }
+  if (value.xml_fragment)
+  {
+#ifdef _LIB_RRLIB_XML_PRESENT_
+    std::string xml = value.ToString();
+    rrlib::xml::tDocument document(xml.c_str(), xml.length() + 1);
+    tValueEncoding::Deserialize(document.RootNode(), object);
+#else
+    throw std::runtime_error("Config entry '" + entry.ToString() + "' requires XML support");
+#endif
+  }
+  else
+  {
+    tNumericValueParser::Deserialize(value.ToString(), object);
+  }
+  return true;
+}
+
+void tConfigBackend::SerializeEntry(const tConfigPath& entry, const rrlib::rtti::tGenericObject& object)
+{
+  rrlib::serialization::tStringOutputStream stream;
+  object.Serialize(stream);
+  SetValue(entry, stream.ToString(), false);
+}
+
+void tConfigBackend::SetValue(const tConfigPath& entry, const std::string& value, bool xml_fragment)
+{
+  throw std::runtime_error("Cannot set config entry '" + entry.ToString() + "': config file is read-only");
+}
+
+std::string tConfigBackend::GetFileContent() const
+{
+  throw std::runtime_error("Cannot write config file: it is read-only");
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,213 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tConfigBackend.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tConfigBackend
+ *
+ * \b tConfigBackend
+ *
+ * Storage of config file entries that is used instead of an XML document.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__parameters__internal__tConfigBackend_h__
+#define __plugins__parameters__internal__tConfigBackend_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/rtti/rtti.h"
+#include "rrlib/util/tNoncopyable.h"
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tConfigPath.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Config file backend
+/*!
+ * Storage of config file entries that is used instead of an XML document
+ * (e.g. compiled config files - or flat config files in builds without XML support).
+ *
+ * Backends store leaf entries only. Values are text - or the XML of a value node
+ * (the latter can only be deserialized with XML support).
+ */
+class tConfigBackend : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Kind of backend */
+  enum class tKind
+  {
+    COMPILED,  //!< Compiled config file (see tCompiledConfig)
+    FLAT       //!< Flat config file (see tFlatConfig)
+  };
+
+  /*! Entry to write to backend */
+  struct tEntry
+  {
+    /*! Qualified name of entry (names separated with '/', no leading slash) */
+    std::string name;
+
+    /*! Value of entry (text content or XML of value node) */
+    std::string value;
+
+    /*! Does value contain XML of value node? */
+    bool xml_fragment;
+  };
+
+  /*! Value of entry in backend (points to memory owned by backend - valid until backend is modified) */
+  struct tValue
+  {
+    /*! Pointer to value data */
+    const char* data;
+
+    /*! Size of value data */
+    size_t size;
+
+    /*! Does value contain XML of value node? */
+    bool xml_fragment;
+
+    std::string ToString() const
+    {
+      return std::string(data, size);
+    }
+  };
+
+  virtual ~tConfigBackend() {}
+
+  /*!
+   * Deserializes value of entry to specified object
+   *
+   * \param entry Path of entry
+   * \param object Object to deserialize value to
+   * \return True if entry exists and value was deserialized. False if there is no such entry.
+   *
+   * \throw Throws any exceptions that occur during deserialization (std::runtime_error if value requires XML support)
+   */
+  bool DeserializeEntry(const tConfigPath& entry, rrlib::rtti::tGenericObject& object) const;
+
+  /*!
+   * Searches entry in backend
+   *
+   * \param entry Path of entry
+   * \param result Contains value of entry after call (if entry was found)
+   * \return True if entry was found
+   */
+  virtual bool Find(const tConfigPath& entry, tValue& result) const = 0;
+
+  /*!
+   * \return Kind of backend
+   */
+  virtual tKind GetKind() const = 0;
+
+  /*!
+   * \param index Index of entry
+   * \return Qualified name of entry with specified index
+   */
+  virtual std::string GetName(size_t index) const = 0;
+
+  /*!
+   * \param index Index of entry
+   * \return Value of entry with specified index
+   */
+  virtual tValue GetValue(size_t index) const = 0;
+
+  /*!
+   * \return Can entries be modified and written to file? (see SetValue() and GetFileContent())
+   */
+  virtual bool IsWritable() const
+  {
+    return false;
+  }
+
+  /*!
+   * Serializes object to entry (string serialization)
+   *
+   * \param entry Path of entry (created if it does not exist)
+   * \param object Object to serialize
+   *
+   * \throw Throws std::runtime_error if backend is not writable
+   */
+  void SerializeEntry(const tConfigPath& entry, const rrlib::rtti::tGenericObject& object);
+
+  /*!
+   * Sets value of entry
+   *
+   * \param entry Path of entry (created if it does not exist)
+   * \param value New value of entry
+   * \param xml_fragment Does value contain XML of value node?
+   *
+   * \throw Throws std::runtime_error if backend is not writable
+   */
+  virtual void SetValue(const tConfigPath& entry, const std::string& value, bool xml_fragment);
+
+  /*!
+   * \return Number of entries in backend
+   */
+  virtual size_t Size() const = 0;
+
+  /*!
+   * \return Content of file with all entries (in backend's format)
+   *
+   * \throw Throws std::runtime_error if backend is not writable
+   */
+  virtual std::string GetFileContent() const;
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,190 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tConfigPath.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tConfigPath.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstring>
+#include <algorithm>
+#include <unordered_set>
+#include "rrlib/logging/messages.h"
+#include "rrlib/thread/tLock.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Table with all interned segments */
+struct tSegmentTable
+{
+  /*! Mutex for table */
+  rrlib::thread::tMutex mutex;
+
+  /*! Interned segment names (elements are never removed - so pointers to them remain valid) */
+  std::unordered_set<std::string> names;
+};
+
+/*!
+ * \return Table with all interned segments
+ */
+static tSegmentTable& SegmentTable()
+{
+  static tSegmentTable table;
+  return table;
+}
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tConfigPath::tConfigPath(const std::string& path) :
+  segments(),
+  absolute(path.length() > 0 && path[0] == '/')
+{
+  if (path.find("//") != std::string::npos)
+  {
+    FINROC_LOG_PRINT_STATIC(WARNING, "Entry '", path, "' seems to be not clean (sequential slashes). Skipping one slash now, as this is typically intended. Please fix this!");
+  }
+  Append(path);
+}
+
+void tConfigPath::Append(const std::string& path)
+{
+  size_t start = 0;
+  while (start < path.length())
+  {
+    size_t end = path.find('/', start);
+    end = (end == std::string::npos) ? path.length() : end;
+    if (end > start)
+    {
+      segments.push_back(Intern(path.substr(start, end - start)));
+    }
+    start = end + 1;
+  }
+}
+
+int tConfigPath::Compare(const char* name, size_t length) const
+{
+  size_t position = 0;
+  for (size_t i = 0; i < segments.size(); i++)
+  {
+    if (i > 0)
+    {
+      if (position >= length)
+      {
+        return 1;
+      }
+      if (name[position] != '/')
+      {
+        return '/' < static_cast<unsigned char>(name[position]) ? -1 : 1;
+      }
+      position++;
+    }
+    const std::string& segment = *segments[i];
+    size_t compare_length = std::min(segment.length(), length - position);
+    int result = memcmp(segment.data(), name + position, compare_length);
+    if (result != 0)
+    {
+      return result;
+    }
+    if (compare_length < segment.length())
+    {
+      return 1;
+    }
+    position += compare_length;
+  }
+  return position < length ? -1 : 0;
+}
+
+size_t tConfigPath::Hash() const
+{
+  size_t result = segments.size();
+  for (tSegment segment : segments)
+  {
+    result ^= std::hash<tSegment>()(segment) + 0x9e3779b9 + (result << 6) + (result >> 2);
+  }
+  return result;
+}
+
+tConfigPath::tSegment tConfigPath::Intern(const std::string& name)
+{
+  tSegmentTable& table = SegmentTable();
+  rrlib::thread::tLock lock(table.mutex);
+  return &(*table.names.insert(name).first);
+}
+
+std::string tConfigPath::ToString() const
+{
+  std::string result;
+  for (tSegment segment : segments)
+  {
+    if (result.length())
+    {
+      result += '/';
+    }
+    result += *segment;
+  }
+  return result;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
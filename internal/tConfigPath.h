@@ -0,0 +1,257 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tConfigPath.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tConfigPath
+ *
+ * \b tConfigPath
+ *
+ * Pre-tokenized path of a config file entry.
+ * Consists of a sequence of interned path segments.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__parameters__internal__tConfigPath_h__
+#define __plugins__parameters__internal__tConfigPath_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <functional>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Config file entry path
+/*!
+ * Pre-tokenized path of a config file entry.
+ * Consists of a sequence of interned path segments.
+ * Segments are interned globally (and never freed) - so each segment is identified by a pointer to its unique name.
+ * Hence, paths can be compared and hashed without comparing any strings.
+ *
+ * Paths are tokenized once (e.g. when a parameter's config entry is set).
+ * Building and resolving paths afterwards does not allocate any memory if a path object is reused.
+ */
+class tConfigPath
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Interned path segment (points to unique name of segment) */
+  typedef const std::string* tSegment;
+
+  /*!
+   * Creates empty (relative) path
+   */
+  tConfigPath() :
+    segments(),
+    absolute(false)
+  {}
+
+  /*!
+   * \param path Path as string - with segments separated by '/'.
+   *             Starting with '/' => absolute path. Sequential slashes are skipped (with a warning).
+   */
+  explicit tConfigPath(const std::string& path);
+
+  /*!
+   * Appends segments of another path
+   *
+   * \param path Path whose segments to append (whether it is absolute is ignored)
+   */
+  void Append(const tConfigPath& path)
+  {
+    segments.insert(segments.end(), path.segments.begin(), path.segments.end());
+  }
+
+  /*!
+   * Appends segments of path provided as string
+   *
+   * \param path Path as string - with segments separated by '/' (leading and sequential slashes are skipped)
+   */
+  void Append(const std::string& path);
+
+  /*!
+   * Appends single segment
+   *
+   * \param segment Segment to append
+   */
+  void Append(tSegment segment)
+  {
+    segments.push_back(segment);
+  }
+
+  /*!
+   * Removes all segments and makes path relative (keeps allocated memory)
+   */
+  void Clear()
+  {
+    segments.clear();
+    absolute = false;
+  }
+
+  /*!
+   * Compares string representation of path (segments separated with '/', no leading slash) with specified string - without allocating memory
+   *
+   * \param name Pointer to string
+   * \param length Length of string
+   * \return Value < 0, 0, or > 0 - like std::string::compare
+   */
+  int Compare(const char* name, size_t length) const;
+
+  /*!
+   * \return Does path contain no segments?
+   */
+  bool Empty() const
+  {
+    return segments.empty();
+  }
+
+  /*!
+   * \return Hash value of path
+   */
+  size_t Hash() const;
+
+  /*!
+   * Returns interned segment with specified name (interns it if this has not been done yet)
+   *
+   * \param name Name of segment
+   * \return Interned segment
+   */
+  static tSegment Intern(const std::string& name);
+
+  /*!
+   * \return Is this an absolute path? (relative to config file's root instead of parent config node)
+   */
+  bool IsAbsolute() const
+  {
+    return absolute;
+  }
+
+  /*!
+   * Removes last segment (path must not be empty)
+   */
+  void RemoveLast()
+  {
+    segments.pop_back();
+  }
+
+  /*!
+   * \param absolute Is this an absolute path?
+   */
+  void SetAbsolute(bool absolute)
+  {
+    this->absolute = absolute;
+  }
+
+  /*!
+   * \return Number of segments in path
+   */
+  size_t Size() const
+  {
+    return segments.size();
+  }
+
+  /*!
+   * \return Path as string (segments separated with '/', no leading slash)
+   */
+  std::string ToString() const;
+
+  /*!
+   * Compares segments (whether paths are absolute is not taken into account)
+   */
+  bool operator==(const tConfigPath& other) const
+  {
+    return segments == other.segments;
+  }
+
+  bool operator!=(const tConfigPath& other) const
+  {
+    return segments != other.segments;
+  }
+
+  tSegment operator[](size_t index) const
+  {
+    return segments[index];
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Segments of path */
+  std::vector<tSegment> segments;
+
+  /*! Is this an absolute path? */
+  bool absolute;
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+namespace std
+{
+template <>
+struct hash<finroc::parameters::internal::tConfigPath>
+{
+  size_t operator()(const finroc::parameters::internal::tConfigPath& path) const
+  {
+    return path.Hash();
+  }
+};
+}
+
+
+#endif
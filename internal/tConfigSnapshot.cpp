@@ -0,0 +1,223 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tConfigSnapshot.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tConfigSnapshot.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Node in tree of snapshot (immutable once it is part of a snapshot) */
+struct tConfigSnapshot::tNode
+{
+  /*! Value of entry with this node's path (null if there is none) */
+  tValue value;
+
+  /*! Child nodes - sorted by segment */
+  std::vector<std::pair<tConfigPath::tSegment, std::shared_ptr<const tNode>>> children;
+
+  typedef decltype(children) tChildren;
+
+  /*!
+   * \param segment Segment of child
+   * \return Iterator to child with specified segment - or to position where it would be inserted
+   */
+  tChildren::const_iterator FindChild(tConfigPath::tSegment segment) const
+  {
+    return std::lower_bound(children.begin(), children.end(), segment, [](const tChildren::value_type & child, tConfigPath::tSegment segment)
+    {
+      return child.first < segment;
+    });
+  }
+};
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * Sets value of entry - copying all nodes on the path to the entry
+ *
+ * \param node Node to start at (may be null)
+ * \param path Path of entry
+ * \param index Index of segment in path that node corresponds to
+ * \param value New value
+ * \param copy Copy nodes? (false if nodes are exclusively owned by caller - e.g. when creating a snapshot from scratch)
+ * \return New node (null if node contains no entries anymore)
+ */
+static std::shared_ptr<const tConfigSnapshot::tNode> SetValue(const std::shared_ptr<const tConfigSnapshot::tNode>& node, const tConfigPath& path, size_t index, const tConfigSnapshot::tValue& value, bool copy)
+{
+  typedef tConfigSnapshot::tNode tNode;
+  std::shared_ptr<tNode> result = (!node) ? std::make_shared<tNode>() : (copy ? std::make_shared<tNode>(*node) : std::const_pointer_cast<tNode>(node));
+  if (index == path.Size())
+  {
+    result->value = value;
+  }
+  else
+  {
+    auto position = result->FindChild(path[index]);
+    bool exists = position != result->children.end() && position->first == path[index];
+    auto child = SetValue(exists ? position->second : std::shared_ptr<const tNode>(), path, index + 1, value, copy);
+    auto it = result->children.begin() + (position - result->children.cbegin());
+    if (child && exists)
+    {
+      it->second = child;
+    }
+    else if (child)
+    {
+      result->children.emplace(it, path[index], child);
+    }
+    else if (exists)
+    {
+      result->children.erase(it);
+    }
+  }
+  return (result->value || result->children.size()) ? result : std::shared_ptr<const tNode>();
+}
+
+/*!
+ * Determines entries that differ in two subtrees (recursively)
+ *
+ * \param node1 Node in first snapshot (may be null)
+ * \param node2 Node in second snapshot (may be null)
+ * \param path Path of nodes (temporarily extended during call)
+ * \param result Paths of entries that differ are appended to this vector
+ */
+static void DiffNodes(const tConfigSnapshot::tNode* node1, const tConfigSnapshot::tNode* node2, tConfigPath& path, std::vector<tConfigPath>& result)
+{
+  if (node1 == node2)
+  {
+    return;  // shared subtree
+  }
+  const tConfigSnapshot::tValue empty_value;
+  const tConfigSnapshot::tValue& value1 = node1 ? node1->value : empty_value;
+  const tConfigSnapshot::tValue& value2 = node2 ? node2->value : empty_value;
+  if (value1 != value2 && ((!value1) || (!value2) || (*value1) != (*value2)))
+  {
+    result.push_back(path);
+  }
+
+  // merge children (sorted by segment)
+  static const decltype(tConfigSnapshot::tNode::children) cNO_CHILDREN;
+  const auto& children1 = node1 ? node1->children : cNO_CHILDREN;
+  const auto& children2 = node2 ? node2->children : cNO_CHILDREN;
+  auto it1 = children1.begin(), it2 = children2.begin();
+  while (it1 != children1.end() || it2 != children2.end())
+  {
+    bool take1 = it1 != children1.end() && (it2 == children2.end() || it1->first <= it2->first);
+    bool take2 = it2 != children2.end() && (it1 == children1.end() || it2->first <= it1->first);
+    path.Append(take1 ? it1->first : it2->first);
+    DiffNodes(take1 ? it1->second.get() : nullptr, take2 ? it2->second.get() : nullptr, path, result);
+    path.RemoveLast();
+    it1 += take1 ? 1 : 0;
+    it2 += take2 ? 1 : 0;
+  }
+}
+
+tConfigSnapshot::tConfigSnapshot(const std::shared_ptr<const tNode>& root, uint64_t lineage, uint64_t revision) :
+  root(root),
+  lineage(lineage),
+  revision(revision)
+{}
+
+std::shared_ptr<const tConfigSnapshot> tConfigSnapshot::Create(const std::vector<tChange>& entries, uint64_t lineage, uint64_t revision)
+{
+  std::shared_ptr<const tNode> root;
+  for (auto & entry : entries)
+  {
+    root = SetValue(root, entry.first, 0, entry.second, false);
+  }
+  return std::shared_ptr<const tConfigSnapshot>(new tConfigSnapshot(root, lineage, revision));
+}
+
+void tConfigSnapshot::Diff(const tConfigSnapshot& snapshot1, const tConfigSnapshot& snapshot2, std::vector<tConfigPath>& result)
+{
+  tConfigPath path;
+  DiffNodes(snapshot1.root.get(), snapshot2.root.get(), path, result);
+}
+
+const std::string* tConfigSnapshot::Find(const tConfigPath& entry) const
+{
+  const tNode* node = root.get();
+  for (size_t i = 0; i < entry.Size() && node; i++)
+  {
+    auto it = node->FindChild(entry[i]);
+    node = (it != node->children.end() && it->first == entry[i]) ? it->second.get() : nullptr;
+  }
+  return (node && node->value) ? node->value.get() : nullptr;
+}
+
+std::shared_ptr<const tConfigSnapshot> tConfigSnapshot::With(const std::vector<tChange>& changes, uint64_t lineage, uint64_t revision) const
+{
+  std::shared_ptr<const tNode> new_root = root;
+  for (auto & change : changes)
+  {
+    new_root = SetValue(new_root, change.first, 0, change.second, true);
+  }
+  return std::shared_ptr<const tConfigSnapshot>(new tConfigSnapshot(new_root, lineage, revision));
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,171 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tConfigSnapshot.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tConfigSnapshot
+ *
+ * \b tConfigSnapshot
+ *
+ * Immutable snapshot of a config file's entries.
+ * Snapshots share all unchanged subtrees with the snapshots they were derived from.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__parameters__internal__tConfigSnapshot_h__
+#define __plugins__parameters__internal__tConfigSnapshot_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tConfigPath.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Config file snapshot
+/*!
+ * Immutable snapshot of a config file's entries.
+ * Contains the XML of each leaf entry's value node - organized as a tree of path segments.
+ *
+ * Snapshots are derived from other snapshots by copying only the nodes on the paths to changed entries.
+ * All other subtrees are shared (reference-counted).
+ * Hence, snapshots are cheap to create and to keep - and can be compared efficiently.
+ */
+class tConfigSnapshot
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Node in snapshot's tree (defined in .cpp file) */
+  struct tNode;
+
+  /*! Value of entry (XML of value node - null if entry is removed) */
+  typedef std::shared_ptr<const std::string> tValue;
+
+  /*! Changed entry (see With()) */
+  typedef std::pair<tConfigPath, tValue> tChange;
+
+  /*!
+   * Creates snapshot from scratch
+   *
+   * \param entries All entries (path and XML of value node)
+   * \param lineage Lineage of config file's document
+   * \param revision Revision of config file's document
+   * \return Created snapshot
+   */
+  static std::shared_ptr<const tConfigSnapshot> Create(const std::vector<tChange>& entries, uint64_t lineage, uint64_t revision);
+
+  /*!
+   * Determines entries that differ in two snapshots
+   * (subtrees shared by both snapshots are skipped)
+   *
+   * \param snapshot1 First snapshot
+   * \param snapshot2 Second snapshot
+   * \param result Paths of entries that differ are appended to this vector
+   */
+  static void Diff(const tConfigSnapshot& snapshot1, const tConfigSnapshot& snapshot2, std::vector<tConfigPath>& result);
+
+  /*!
+   * \param entry Path of entry
+   * \return XML of entry's value node - or nullptr if snapshot contains no such entry
+   */
+  const std::string* Find(const tConfigPath& entry) const;
+
+  /*!
+   * \return Lineage of config file's document that snapshot was created from
+   */
+  uint64_t GetLineage() const
+  {
+    return lineage;
+  }
+
+  /*!
+   * \return Revision of config file's document that snapshot was created from
+   */
+  uint64_t GetRevision() const
+  {
+    return revision;
+  }
+
+  /*!
+   * Creates new snapshot with the specified changes
+   *
+   * \param changes Changed entries (entries with null value are removed)
+   * \param lineage Lineage of new snapshot
+   * \param revision Revision of new snapshot
+   * \return New snapshot (sharing all unchanged subtrees with this one)
+   */
+  std::shared_ptr<const tConfigSnapshot> With(const std::vector<tChange>& changes, uint64_t lineage, uint64_t revision) const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Root node of tree (null if snapshot contains no entries) */
+  std::shared_ptr<const tNode> root;
+
+  /*! Lineage and revision of config file's document that snapshot was created from */
+  uint64_t lineage, revision;
+
+
+  tConfigSnapshot(const std::shared_ptr<const tNode>& root, uint64_t lineage, uint64_t revision);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,263 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tFileWatcher.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tFileWatcher.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include "rrlib/logging/messages.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Events that indicate that a file in a watched directory was modified or replaced */
+static const uint32_t cWATCHED_EVENTS = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tFileWatcher::tFileWatcher() :
+  mutex(),
+  inotify_descriptor(inotify_init1(IN_NONBLOCK | IN_CLOEXEC)),
+  wakeup_pipe { -1, -1 },
+  watches(),
+  next_id(1),
+  thread(),
+  stop(false)
+{
+  if (inotify_descriptor < 0 || pipe2(wakeup_pipe, O_NONBLOCK | O_CLOEXEC) != 0)
+  {
+    FINROC_LOG_PRINT(ERROR, "Could not initialize file watcher: ", strerror(errno));
+    return;
+  }
+  thread = std::thread(&tFileWatcher::Run, this);
+}
+
+tFileWatcher::~tFileWatcher()
+{
+  if (thread.joinable())
+  {
+    {
+      rrlib::thread::tLock lock(mutex);
+      stop = true;
+    }
+    char c = 0;
+    if (write(wakeup_pipe[1], &c, 1) < 0)
+    {
+      FINROC_LOG_PRINT(WARNING, "Could not wake up file watcher thread");
+    }
+    thread.join();
+  }
+  for (int fd : { inotify_descriptor, wakeup_pipe[0], wakeup_pipe[1] })
+  {
+    if (fd >= 0)
+    {
+      close(fd);
+    }
+  }
+}
+
+int tFileWatcher::AddWatch(const std::string& file, std::chrono::milliseconds debounce, const tCallback& callback)
+{
+  if (!thread.joinable())
+  {
+    throw std::runtime_error("File watcher is not available");
+  }
+  size_t slash_index = file.rfind('/');
+  std::string directory = (slash_index == std::string::npos) ? "." : (slash_index == 0 ? "/" : file.substr(0, slash_index));
+  std::string file_name = (slash_index == std::string::npos) ? file : file.substr(slash_index + 1);
+
+  rrlib::thread::tLock lock(mutex);
+  int directory_descriptor = inotify_add_watch(inotify_descriptor, directory.c_str(), cWATCHED_EVENTS);
+  if (directory_descriptor < 0)
+  {
+    throw std::runtime_error("Could not watch directory '" + directory + "': " + strerror(errno));
+  }
+  int id = next_id++;
+  watches.emplace(id, tWatch { directory_descriptor, file_name, debounce, callback, false, std::chrono::steady_clock::time_point() });
+  return id;
+}
+
+tFileWatcher& tFileWatcher::GetInstance()
+{
+  static tFileWatcher instance;
+  return instance;
+}
+
+void tFileWatcher::RemoveWatch(int id)
+{
+  rrlib::thread::tLock lock(mutex);
+  auto it = watches.find(id);
+  if (it == watches.end())
+  {
+    return;
+  }
+  int directory_descriptor = it->second.directory_descriptor;
+  watches.erase(it);
+
+  // remove inotify watch if no other file in directory is watched (watch descriptors are shared per directory)
+  for (auto & watch : watches)
+  {
+    if (watch.second.directory_descriptor == directory_descriptor)
+    {
+      return;
+    }
+  }
+  inotify_rm_watch(inotify_descriptor, directory_descriptor);
+}
+
+void tFileWatcher::Run()
+{
+  alignas(struct inotify_event) char buffer[4096];
+  std::vector<tCallback> callbacks;
+  while (true)
+  {
+    // determine timeout
+    int timeout = -1;
+    {
+      rrlib::thread::tLock lock(mutex);
+      if (stop)
+      {
+        return;
+      }
+      auto now = std::chrono::steady_clock::now();
+      for (auto & watch : watches)
+      {
+        if (watch.second.pending)
+        {
+          int remaining = static_cast<int>(std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::milliseconds>(watch.second.deadline - now).count() + 1));
+          timeout = (timeout < 0) ? remaining : std::min(timeout, remaining);
+        }
+      }
+    }
+
+    struct pollfd descriptors[2] = { { inotify_descriptor, POLLIN, 0 }, { wakeup_pipe[0], POLLIN, 0 } };
+    if (poll(descriptors, 2, timeout) < 0 && errno != EINTR)
+    {
+      FINROC_LOG_PRINT(ERROR, "File watcher failed: ", strerror(errno));
+      return;
+    }
+
+    rrlib::thread::tLock lock(mutex);
+    if (stop)
+    {
+      return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    ssize_t length;
+    while ((length = read(inotify_descriptor, buffer, sizeof(buffer))) > 0)
+    {
+      for (char* event_pointer = buffer; event_pointer < buffer + length;)
+      {
+        const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(event_pointer);
+        if (event->len > 0)
+        {
+          for (auto & watch : watches)
+          {
+            if (watch.second.directory_descriptor == event->wd && watch.second.file_name == event->name)
+            {
+              watch.second.pending = true;
+              watch.second.deadline = now + watch.second.debounce;
+            }
+          }
+        }
+        event_pointer += sizeof(struct inotify_event) + event->len;
+      }
+    }
+
+    // collect callbacks whose debounce period has passed
+    callbacks.clear();
+    for (auto & watch : watches)
+    {
+      if (watch.second.pending && watch.second.deadline <= now)
+      {
+        watch.second.pending = false;
+        callbacks.push_back(watch.second.callback);
+      }
+    }
+    lock.Unlock();
+
+    for (auto & callback : callbacks)
+    {
+      try
+      {
+        callback();
+      }
+      catch (const std::exception& e)
+      {
+        FINROC_LOG_PRINT(ERROR, e);
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
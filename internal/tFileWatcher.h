@@ -0,0 +1,180 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tFileWatcher.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tFileWatcher
+ *
+ * \b tFileWatcher
+ *
+ * Watches files for modifications (using inotify) and notifies callbacks.
+ * Bursts of modifications are debounced.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__parameters__internal__tFileWatcher_h__
+#define __plugins__parameters__internal__tFileWatcher_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include "rrlib/thread/tLock.h"
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string>
+#include <thread>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! File watcher
+/*!
+ * Watches files for modifications (using inotify) and notifies callbacks.
+ * The directory containing a file is watched - so that files replaced by editors (via rename) are detected as well.
+ * A callback is called once no further modification occurred for the specified debounce period.
+ *
+ * Callbacks are called from the watcher's thread - without holding any of the watcher's locks.
+ * So they may still be called shortly after their watch has been removed.
+ */
+class tFileWatcher : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef std::function<void()> tCallback;
+
+  ~tFileWatcher();
+
+  /*!
+   * Starts watching file
+   *
+   * \param file File to watch
+   * \param debounce Period without further modifications after which callback is called
+   * \param callback Callback to call when file was modified
+   * \return Id of watch (to be passed to RemoveWatch())
+   *
+   * \throw Throws std::runtime_error if file cannot be watched
+   */
+  int AddWatch(const std::string& file, std::chrono::milliseconds debounce, const tCallback& callback);
+
+  /*!
+   * \return Watcher instance (watcher thread is started on first use)
+   */
+  static tFileWatcher& GetInstance();
+
+  /*!
+   * Stops watching file
+   *
+   * \param id Id of watch (as returned by AddWatch())
+   */
+  void RemoveWatch(int id);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Watched file */
+  struct tWatch
+  {
+    /*! Watch descriptor of directory containing file */
+    int directory_descriptor;
+
+    /*! Name of file (without directory) */
+    std::string file_name;
+
+    /*! Debounce period */
+    std::chrono::milliseconds debounce;
+
+    /*! Callback to call */
+    tCallback callback;
+
+    /*! Is there a modification that callback has not been called for? */
+    bool pending;
+
+    /*! Time at which callback is to be called (if pending) */
+    std::chrono::steady_clock::time_point deadline;
+  };
+
+  /*! Mutex for watches */
+  rrlib::thread::tMutex mutex;
+
+  /*! inotify file descriptor */
+  int inotify_descriptor;
+
+  /*! Pipe to wake up watcher thread (on termination) */
+  int wakeup_pipe[2];
+
+  /*! Watch id => watch */
+  std::map<int, tWatch> watches;
+
+  /*! Id of next watch */
+  int next_id;
+
+  /*! Watcher thread */
+  std::thread thread;
+
+  /*! Is watcher thread to terminate? */
+  bool stop;
+
+
+  tFileWatcher();
+
+  /*! Main loop of watcher thread */
+  void Run();
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
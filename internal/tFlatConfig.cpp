@@ -0,0 +1,314 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tFlatConfig.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tFlatConfig.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+constexpr const char* tFlatConfig::cFILE_EXTENSION;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * \param text Text to escape
+ * \param result Escaped text is appended to this string
+ * \param name Is text the name of an entry? (then leading '#' and whitespace at the beginning and end are escaped as well - as they are skipped when reading lines)
+ */
+static void Escape(const std::string& text, std::string& result, bool name)
+{
+  size_t content_start = 0, content_end = text.length();
+  while (name && content_start < text.length() && isspace(text[content_start]))
+  {
+    content_start++;
+  }
+  while (name && content_end > content_start && isspace(text[content_end - 1]))
+  {
+    content_end--;
+  }
+  for (size_t i = 0; i < text.length(); i++)
+  {
+    char c = text[i];
+    if (c == '\\' || c == '=' || c == ':')
+    {
+      result += '\\';
+      result += c;
+    }
+    else if (c == '\n')
+    {
+      result += "\\n";
+    }
+    else if (c == '\r')
+    {
+      result += "\\r";
+    }
+    else if (name && ((i == 0 && c == '#') || i < content_start || i >= content_end))
+    {
+      result += '\\';
+      result += c;
+    }
+    else
+    {
+      result += c;
+    }
+  }
+}
+
+/*!
+ * \param text Escaped text
+ * \param result Contains unescaped text after call
+ * \return False if text contains invalid escape sequence
+ */
+static bool Unescape(const std::string& text, std::string& result)
+{
+  result.clear();
+  for (size_t i = 0; i < text.length(); i++)
+  {
+    if (text[i] != '\\')
+    {
+      result += text[i];
+      continue;
+    }
+    if (++i == text.length())
+    {
+      return false;
+    }
+    char c = text[i];
+    result += (c == 'n') ? '\n' : ((c == 'r') ? '\r' : c);
+  }
+  return true;
+}
+
+/*!
+ * \param line Line
+ * \param position Position of character in line
+ * \param start Position in line that escaping starts at
+ * \return Is character at specified position escaped with a backslash?
+ */
+static bool IsEscaped(const std::string& line, size_t position, size_t start)
+{
+  size_t backslashes = 0;
+  while (position > start + backslashes && line[position - backslashes - 1] == '\\')
+  {
+    backslashes++;
+  }
+  return backslashes % 2 == 1;
+}
+
+/*!
+ * Parses line of flat config file
+ *
+ * \param line Line (without line break)
+ * \param entry Contains entry after call (if line contains an entry)
+ * \return 1 if line contains an entry, 0 if it is empty or a comment, -1 if it is invalid, -2 if it contains an invalid escape sequence
+ */
+static int ParseLine(const std::string& line, tConfigBackend::tEntry& entry)
+{
+  size_t start = 0;
+  while (start < line.length() && isspace(line[start]))
+  {
+    start++;
+  }
+  if (start == line.length() || line[start] == '#')
+  {
+    return 0;
+  }
+
+  // find unescaped separator
+  size_t separator = start;
+  while (separator < line.length() && line[separator] != '=' && line[separator] != ':')
+  {
+    separator += (line[separator] == '\\') ? 2 : 1;
+  }
+  entry.xml_fragment = separator < line.length() && line[separator] == ':';
+  size_t value_start = separator + (entry.xml_fragment ? 2 : 1);
+  if (separator >= line.length() || (entry.xml_fragment && line.compare(separator, 2, ":=") != 0))
+  {
+    return -1;
+  }
+  size_t name_end = separator;
+  while (name_end > start && isspace(line[name_end - 1]) && (!IsEscaped(line, name_end - 1, start)))
+  {
+    name_end--;
+  }
+  if (value_start < line.length() && line[value_start] == ' ')
+  {
+    value_start++;
+  }
+  if ((!Unescape(line.substr(start, name_end - start), entry.name)) || (!Unescape(value_start < line.length() ? line.substr(value_start) : std::string(), entry.value)))
+  {
+    return -2;
+  }
+  return 1;
+}
+
+tFlatConfig::tFlatConfig() :
+  entries(),
+  entry_index()
+{}
+
+tFlatConfig::tFlatConfig(const std::string& file) :
+  entries(),
+  entry_index()
+{
+  std::ifstream stream(file);
+  if (!stream)
+  {
+    throw std::runtime_error("Could not open flat config file '" + file + "'");
+  }
+  std::string line;
+  tEntry entry;
+  for (size_t line_number = 1; std::getline(stream, line); line_number++)
+  {
+    if (line.length() && line.back() == '\r')
+    {
+      line.pop_back();
+    }
+    int result = ParseLine(line, entry);
+    if (result == -1)
+    {
+      throw std::runtime_error("Invalid entry in flat config file '" + file + "' (line " + std::to_string(line_number) + ")");
+    }
+    if (result == -2)
+    {
+      throw std::runtime_error("Invalid escape sequence in flat config file '" + file + "' (line " + std::to_string(line_number) + ")");
+    }
+    if (result == 1)
+    {
+      SetValue(tConfigPath(entry.name), entry.value, entry.xml_fragment);
+    }
+  }
+}
+
+bool tFlatConfig::Find(const tConfigPath& entry, tValue& result) const
+{
+  auto it = entry_index.find(entry);
+  if (it == entry_index.end())
+  {
+    return false;
+  }
+  result = GetValue(it->second);
+  return true;
+}
+
+std::string tFlatConfig::GetFileContent(const std::vector<tEntry>& entries)
+{
+  std::string content;
+  for (const tEntry & entry : entries)
+  {
+    size_t line_start = content.length();
+    Escape(entry.name, content, true);
+    content += entry.xml_fragment ? " := " : " = ";
+    Escape(entry.value, content, false);
+
+#ifndef NDEBUG
+    // round trip check: line must be read back as the same entry
+    tEntry read_entry;
+    assert(ParseLine(content.substr(line_start), read_entry) == 1 && read_entry.name == entry.name && read_entry.value == entry.value && read_entry.xml_fragment == entry.xml_fragment);
+#endif
+    content += '\n';
+  }
+  return content;
+}
+
+std::string tFlatConfig::GetName(size_t index) const
+{
+  assert(index < entries.size());
+  return entries[index].name;
+}
+
+tFlatConfig::tValue tFlatConfig::GetValue(size_t index) const
+{
+  assert(index < entries.size());
+  const tEntry& entry = entries[index];
+  return tValue { entry.value.data(), entry.value.length(), entry.xml_fragment };
+}
+
+bool tFlatConfig::IsFlatFile(const std::string& filename)
+{
+  size_t extension_length = strlen(cFILE_EXTENSION);
+  return filename.length() > extension_length && filename.compare(filename.length() - extension_length, extension_length, cFILE_EXTENSION) == 0;
+}
+
+void tFlatConfig::SetValue(const tConfigPath& entry, const std::string& value, bool xml_fragment)
+{
+  auto it = entry_index.find(entry);
+  if (it != entry_index.end())
+  {
+    entries[it->second].value = value;
+    entries[it->second].xml_fragment = xml_fragment;
+    return;
+  }
+  entry_index.emplace(entry, entries.size());
+  entries.push_back(tEntry { entry.ToString(), value, xml_fragment });
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,166 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tFlatConfig.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tFlatConfig
+ *
+ * \b tFlatConfig
+ *
+ * Flat config file.
+ * Plain text file with one entry per line - usable without XML support.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__parameters__internal__tFlatConfig_h__
+#define __plugins__parameters__internal__tFlatConfig_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <unordered_map>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tConfigBackend.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Flat config file
+/*!
+ * Plain text config file with one leaf entry per line:
+ *
+ *   # comment
+ *   path/to/entry = value
+ *   path/to/other := <value name="other">...</value>
+ *
+ * '=' separates entry from its text value, ':=' from the XML of its value node.
+ * Backslash, line breaks, '=' and ':' are escaped with a backslash ('\n' for line breaks).
+ * In entry names, a leading '#' and leading or trailing whitespace are escaped as well.
+ *
+ * Flat config files can be read and written without XML support - e.g. in minimal embedded builds.
+ * Entries keep the order they have in the file. New entries are appended.
+ */
+class tFlatConfig : public tConfigBackend
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! File extension of flat config files */
+  static constexpr const char* cFILE_EXTENSION = ".flat";
+
+  /*!
+   * Creates empty flat config file
+   */
+  tFlatConfig();
+
+  /*!
+   * \param file File name of flat config file to load
+   *
+   * \throw Throws std::runtime_error if file cannot be read or contains invalid lines
+   */
+  tFlatConfig(const std::string& file);
+
+  virtual bool Find(const tConfigPath& entry, tValue& result) const override;
+
+  /*!
+   * \param entries Entries (in this order)
+   * \return Content of flat config file with specified entries
+   */
+  static std::string GetFileContent(const std::vector<tEntry>& entries);
+
+  virtual std::string GetFileContent() const override
+  {
+    return GetFileContent(entries);
+  }
+
+  virtual tKind GetKind() const override
+  {
+    return tKind::FLAT;
+  }
+
+  virtual std::string GetName(size_t index) const override;
+
+  virtual tValue GetValue(size_t index) const override;
+
+  /*!
+   * \param filename File name
+   * \return True if file name has the extension of flat config files
+   */
+  static bool IsFlatFile(const std::string& filename);
+
+  virtual bool IsWritable() const override
+  {
+    return true;
+  }
+
+  virtual void SetValue(const tConfigPath& entry, const std::string& value, bool xml_fragment) override;
+
+  virtual size_t Size() const override
+  {
+    return entries.size();
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! All entries (in file order) */
+  std::vector<tEntry> entries;
+
+  /*! Path of entry => index in entries */
+  std::unordered_map<tConfigPath, size_t> entry_index;
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,293 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tNumericValueParser.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tNumericValueParser.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/serialization/serialization.h"
+#include "plugins/data_ports/numeric/tNumber.h"
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <locale.h>
+#include <type_traits>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * \return "C" locale - so that parsing does not depend on LC_NUMERIC of the process (e.g. "1,5" must not be accepted)
+ */
+static locale_t CLocale()
+{
+  static const locale_t c_locale = newlocale(LC_ALL_MASK, "C", static_cast<locale_t>(0));
+  return c_locale;
+}
+
+/*!
+ * \param s String
+ * \return Can string be parsed by strtoll/strtod without ambiguity? (non-empty, no leading whitespace, no leading '+')
+ */
+static inline bool IsPlainNumber(const std::string& s)
+{
+  return s.length() > 0 && (isdigit(static_cast<unsigned char>(s[0])) || s[0] == '-' || s[0] == '.');
+}
+
+/*!
+ * Parses signed integer
+ *
+ * \param s String
+ * \param result Parsed value
+ * \return True if complete string was parsed and value is in range of T
+ */
+template <typename T>
+static bool ParseSigned(const std::string& s, T& result)
+{
+  if (!IsPlainNumber(s))
+  {
+    return false;
+  }
+  char* end = nullptr;
+  errno = 0;
+  long long value = strtoll(s.c_str(), &end, 10);
+  if (errno || *end || value < std::numeric_limits<T>::min() || value > std::numeric_limits<T>::max())
+  {
+    return false;
+  }
+  result = static_cast<T>(value);
+  return true;
+}
+
+/*!
+ * Parses unsigned integer
+ *
+ * \param s String
+ * \param result Parsed value
+ * \return True if complete string was parsed and value is in range of T
+ */
+template <typename T>
+static bool ParseUnsigned(const std::string& s, T& result)
+{
+  if (!IsPlainNumber(s) || s[0] == '-')
+  {
+    return false;
+  }
+  char* end = nullptr;
+  errno = 0;
+  unsigned long long value = strtoull(s.c_str(), &end, 10);
+  if (errno || *end || value > std::numeric_limits<T>::max())
+  {
+    return false;
+  }
+  result = static_cast<T>(value);
+  return true;
+}
+
+/*!
+ * Parses floating point number
+ *
+ * \param s String
+ * \param result Parsed value
+ * \return True if complete string was parsed and value is finite and in range of T
+ */
+template <typename T>
+static bool ParseFloatingPoint(const std::string& s, T& result)
+{
+  if ((!IsPlainNumber(s)) || s.find_first_of("xX") != std::string::npos || (!CLocale()))  // no hexadecimal floating point numbers
+  {
+    return false;
+  }
+  char* end = nullptr;
+  errno = 0;
+  double value = std::is_same<T, float>::value ? strtof_l(s.c_str(), &end, CLocale()) : strtod_l(s.c_str(), &end, CLocale());
+  if (errno || *end || (!std::isfinite(value)) || value < std::numeric_limits<T>::lowest() || value > std::numeric_limits<T>::max())
+  {
+    return false;
+  }
+  result = static_cast<T>(value);
+  return true;
+}
+
+/*!
+ * Parses boolean value
+ *
+ * \param s String
+ * \param result Parsed value
+ * \return True if string is "true" or "false"
+ */
+static bool ParseBool(const std::string& s, bool& result)
+{
+  if (s == "true" || s == "false")
+  {
+    result = s[0] == 't';
+    return true;
+  }
+  return false;
+}
+
+/*!
+ * Parses plain number without unit - selecting numeric type like tNumber's string deserialization
+ * (floating point if it contains a decimal point or an exponent - integer otherwise)
+ *
+ * \param s String
+ * \param result Parsed value
+ * \return True if string is a plain number without unit
+ */
+static bool ParseNumber(const std::string& s, data_ports::numeric::tNumber& result)
+{
+  if (s.find_first_of(".eE") != std::string::npos)
+  {
+    double value;
+    if (ParseFloatingPoint<double>(s, value))
+    {
+      result = data_ports::numeric::tNumber(value);
+      return true;
+    }
+    return false;
+  }
+  int64_t value;
+  if (ParseSigned<int64_t>(s, value))
+  {
+    result = data_ports::numeric::tNumber(value);
+    return true;
+  }
+  return false;
+}
+
+/*!
+ * Parses value into object of type T
+ */
+template <typename T, bool (*PARSE)(const std::string&, T&)>
+static bool Parse(const std::string& s, rrlib::rtti::tGenericObject& object)
+{
+  T value;
+  if (PARSE(s, value))
+  {
+    object.GetData<T>() = value;
+    return true;
+  }
+  return false;
+}
+
+/*! Type with fast path and its parse function */
+struct tParser
+{
+  rrlib::rtti::tType type;
+  bool (*parse)(const std::string&, rrlib::rtti::tGenericObject&);
+};
+
+/*!
+ * \return All types with fast path
+ * (int8_t and uint8_t are excluded, as their string form may be a character.
+ *  tNumber is only handled for plain numbers without unit)
+ */
+static const std::vector<tParser>& Parsers()
+{
+  static const std::vector<tParser> parsers =
+  {
+    { rrlib::rtti::tDataType<double>(), &Parse<double, &ParseFloatingPoint<double>> },
+    { rrlib::rtti::tDataType<int>(), &Parse<int, &ParseSigned<int>> },
+    { rrlib::rtti::tDataType<float>(), &Parse<float, &ParseFloatingPoint<float>> },
+    { rrlib::rtti::tDataType<bool>(), &Parse<bool, &ParseBool> },
+    { rrlib::rtti::tDataType<unsigned int>(), &Parse<unsigned int, &ParseUnsigned<unsigned int>> },
+    { rrlib::rtti::tDataType<long int>(), &Parse<long int, &ParseSigned<long int>> },
+    { rrlib::rtti::tDataType<long long int>(), &Parse<long long int, &ParseSigned<long long int>> },
+    { rrlib::rtti::tDataType<unsigned long int>(), &Parse<unsigned long int, &ParseUnsigned<unsigned long int>> },
+    { rrlib::rtti::tDataType<unsigned long long int>(), &Parse<unsigned long long int, &ParseUnsigned<unsigned long long int>> },
+    { rrlib::rtti::tDataType<short>(), &Parse<short, &ParseSigned<short>> },
+    { rrlib::rtti::tDataType<unsigned short>(), &Parse<unsigned short, &ParseUnsigned<unsigned short>> },
+    { rrlib::rtti::tDataType<data_ports::numeric::tNumber>(), &Parse<data_ports::numeric::tNumber, &ParseNumber> }
+  };
+  return parsers;
+}
+
+void tNumericValueParser::Deserialize(const std::string& s, rrlib::rtti::tGenericObject& object)
+{
+  if (!TryParse(s, object))
+  {
+    rrlib::serialization::tStringInputStream stream(s);
+    object.Deserialize(stream);
+  }
+}
+
+bool tNumericValueParser::TryParse(const std::string& s, rrlib::rtti::tGenericObject& object)
+{
+  rrlib::rtti::tType type = object.GetType();
+  for (const tParser & parser : Parsers())
+  {
+    if (parser.type == type)
+    {
+      return parser.parse(s, object);
+    }
+  }
+  return false;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,110 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tNumericValueParser.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tNumericValueParser
+ *
+ * \b tNumericValueParser
+ *
+ * Fast path for parsing numeric and boolean values from strings.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__parameters__internal__tNumericValueParser_h__
+#define __plugins__parameters__internal__tNumericValueParser_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/rtti/rtti.h"
+#include <string>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Fast numeric value parser
+/*!
+ * Parses numeric and boolean values (e.g. from command line options, finstruct defaults,
+ * or flat config files) directly into objects - without the generic string deserialization
+ * via rrlib::serialization::tStringInputStream.
+ *
+ * Only plain values of built-in numeric types, tNumber and bool are handled (e.g. "42", "-1.5e3", "true").
+ * Anything else (other types, units, surrounding whitespace, out-of-range or non-finite values)
+ * is left to the generic path - so that results and error messages are identical.
+ * Floating point numbers are parsed in the "C" locale - independent of LC_NUMERIC.
+ */
+class tNumericValueParser
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * Deserializes object from string - using fast path if possible
+   *
+   * \param s String to deserialize from
+   * \param object Object to deserialize
+   */
+  static void Deserialize(const std::string& s, rrlib::rtti::tGenericObject& object);
+
+  /*!
+   * \param s String to parse
+   * \param object Object to store value in
+   * \return True if value was parsed and stored. False if string or object type is not supported by fast path (object is not modified then).
+   */
+  static bool TryParse(const std::string& s, rrlib::rtti::tGenericObject& object);
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
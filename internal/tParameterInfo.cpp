@@ -34,14 +34,20 @@
 //----------------------------------------------------------------------
 #include "rrlib/rtti/rtti.h"
 #include "core/port/tAbstractPort.h"
-#include "core/tRuntimeEnvironment.h"
 #include "plugins/data_ports/tGenericPort.h"
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "plugins/parameters/tConfigFile.h"
 #include "plugins/parameters/tConfigNode.h"
+#include "plugins/parameters/internal/tNumericValueParser.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -73,19 +79,262 @@ namespace internal
 /* Initializes parameter info annotation type */
 static rrlib::rtti::tDataType<tParameterInfo> cTYPE;
 
+/*! Minimum number of values that warrant a separate thread for deserializing values in tParameterInfo::LoadValues() */
+static const size_t cMIN_VALUES_PER_DESERIALIZATION_THREAD = 32;
+
+/*! Maximum number of threads deserializing values in tParameterInfo::LoadValues() (including calling thread) */
+static const size_t cMAX_DESERIALIZATION_THREADS = 4;
+
 //----------------------------------------------------------------------
 // Implementation
 //----------------------------------------------------------------------
 
+/*!
+ * \param type Data type
+ * \return Is type one of the numeric types whose values are cached by tValueCache? (values can be compared bytewise)
+ */
+static bool IsCachedNumericType(const rrlib::rtti::tType& type)
+{
+  static const rrlib::rtti::tType cNUMERIC_TYPES[] =
+  {
+    rrlib::rtti::tDataType<double>(), rrlib::rtti::tDataType<float>(), rrlib::rtti::tDataType<int>(), rrlib::rtti::tDataType<bool>(),
+    rrlib::rtti::tDataType<unsigned int>(), rrlib::rtti::tDataType<long int>(), rrlib::rtti::tDataType<unsigned long int>(),
+    rrlib::rtti::tDataType<long long int>(), rrlib::rtti::tDataType<unsigned long long int>(), rrlib::rtti::tDataType<short>(),
+    rrlib::rtti::tDataType<unsigned short>(), rrlib::rtti::tDataType<char>(), rrlib::rtti::tDataType<signed char>(), rrlib::rtti::tDataType<unsigned char>()
+  };
+  for (const rrlib::rtti::tType & numeric_type : cNUMERIC_TYPES)
+  {
+    if (type == numeric_type)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/*!
+ * Persistent pool of threads that help deserializing values in tParameterInfo::LoadValues().
+ * Threads are created once (their number is bounded) and process one job at a time.
+ */
+class tDeserializationPool
+{
+public:
+
+  /*!
+   * \return Pool instance (never deleted - threads wait for jobs until process exits)
+   */
+  static tDeserializationPool& GetInstance()
+  {
+    static tDeserializationPool* instance = new tDeserializationPool();
+    return *instance;
+  }
+
+  /*!
+   * \return Number of threads in pool
+   */
+  size_t GetThreadCount() const
+  {
+    return thread_count;
+  }
+
+  /*!
+   * Executes job with calling thread and the specified number of pool threads
+   * (returns after all of them have finished)
+   *
+   * \param job Job to execute
+   * \param helper_count Number of pool threads that execute job as well
+   * \return False if pool is busy with another job (then job was not executed)
+   */
+  bool TryRun(const std::function<void()>& job, size_t helper_count)
+  {
+    helper_count = std::min(helper_count, thread_count);
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (current_job)
+      {
+        return false;
+      }
+      current_job = &job;
+      waiting_helpers = helper_count;
+      active_helpers = helper_count;
+    }
+    job_available.notify_all();
+    std::exception_ptr exception;
+    try
+    {
+      job();
+    }
+    catch (...)
+    {
+      exception = std::current_exception();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    job_finished.wait(lock, [this]()
+    {
+      return active_helpers == 0;
+    });
+    current_job = nullptr;
+    if (!exception)
+    {
+      exception = helper_exception;
+    }
+    helper_exception = nullptr;
+    if (exception)
+    {
+      std::rethrow_exception(exception);
+    }
+    return true;
+  }
+
+private:
+
+  /*! Mutex for job state */
+  std::mutex mutex;
+
+  /*! Notified when job is available / all helpers finished job */
+  std::condition_variable job_available, job_finished;
+
+  /*! Current job (null if there is none) */
+  const std::function<void()>* current_job;
+
+  /*! Number of helpers that still need to start current job / that have not finished it yet */
+  size_t waiting_helpers, active_helpers;
+
+  /*! Number of threads in pool */
+  size_t thread_count;
+
+  /*! Exception thrown by a helper executing current job (rethrown by thread that started job) */
+  std::exception_ptr helper_exception;
+
+  tDeserializationPool() :
+    mutex(),
+    job_available(),
+    job_finished(),
+    current_job(nullptr),
+    waiting_helpers(0),
+    active_helpers(0),
+    thread_count(std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), cMAX_DESERIALIZATION_THREADS) - 1),
+    helper_exception()
+  {
+    for (size_t i = 0; i < thread_count; i++)
+    {
+      std::thread(&tDeserializationPool::Run, this).detach();
+    }
+  }
+
+  void Run()
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+      job_available.wait(lock, [this]()
+      {
+        return waiting_helpers > 0;
+      });
+      waiting_helpers--;
+      const std::function<void()>* job = current_job;
+      lock.unlock();
+      std::exception_ptr exception;
+      try
+      {
+        (*job)();
+      }
+      catch (...)
+      {
+        exception = std::current_exception();
+      }
+      lock.lock();
+      if (exception)
+      {
+        helper_exception = exception;
+      }
+      if (--active_helpers == 0)
+      {
+        job_finished.notify_all();
+      }
+    }
+  }
+};
+
+/*!
+ * Acquires buffer for deserializing value of pending load
+ * (unless buffer was acquired before deserializing values concurrently - see tParameterInfo::LoadValues())
+ *
+ * \param port Port of pending load
+ * \param load Pending load
+ */
+static void AcquireBuffer(data_ports::tGenericPort& port, tParameterInfo::tPendingLoad& load)
+{
+  if (!load.buffer)
+  {
+    load.buffer = port.GetUnusedBuffer();
+  }
+}
+
+/*!
+ * Publishes buffer via port - unless port already contains an equal value
+ *
+ * \param port Port to publish value with
+ * \param buffer Buffer with new value
+ * \param force_publish Publish even if port already contains an equal value?
+ * \return Error message (empty if value was published successfully - or publishing was not necessary)
+ */
+static std::string Publish(data_ports::tGenericPort& port, data_ports::tPortDataPointer<rrlib::rtti::tGenericObject>& buffer, bool force_publish)
+{
+  if (!force_publish)
+  {
+    data_ports::tPortDataPointer<const rrlib::rtti::tGenericObject> current_value = port.GetPointer();
+    if (current_value && current_value->GetType() == buffer->GetType())
+    {
+      bool equal = IsCachedNumericType(buffer->GetType()) ?
+                   memcmp(current_value->GetRawDataPointer(), buffer->GetRawDataPointer(), buffer->GetType().GetSize()) == 0 :
+                   current_value->Equals(*buffer);
+      if (equal)
+      {
+        return "";
+      }
+    }
+  }
+  return port.BrowserPublish(buffer);
+}
+
 tParameterInfo::tParameterInfo() :
   config_entry(),
+  config_entry_path(),
+  full_config_entry_path(),
   entry_set_from_finstruct(false),
   command_line_option(),
-  finstruct_default()
+  command_line_value(nullptr),
+  finstruct_default(),
+  registered_config_file(nullptr),
+  next_registered(nullptr),
+  previous_registered(nullptr),
+  value_changed(true),
+  loaded_config_file(nullptr),
+  loaded_modification_count(0),
+  loaded_fingerprint(0),
+  loaded_fingerprint_valid(false)
 {}
 
+tParameterInfo::~tParameterInfo()
+{
+  tConfigFile::UnregisterParameter(*this);
+}
+
 void tParameterInfo::AnnotatedObjectInitialized()
 {
+  core::tAbstractPort* ann = this->GetAnnotated<core::tAbstractPort>();
+  tConfigFile* cf = ann ? tConfigFile::Find(*ann) : nullptr;
+  if (cf)
+  {
+    cf->RegisterParameter(*this);
+  }
+  if (ann && data_ports::IsDataFlowType(ann->GetDataType()))
+  {
+    data_ports::tGenericPort::Wrap(*ann).AddPortListenerSimple(*this);
+  }
+
   try
   {
     LoadValue(true);
@@ -96,6 +345,11 @@ void tParameterInfo::AnnotatedObjectInitialized()
   }
 }
 
+void tParameterInfo::AnnotatedObjectToBeDeleted()
+{
+  tConfigFile::UnregisterParameter(*this);
+}
+
 #ifdef _LIB_RRLIB_XML_PRESENT_
 void tParameterInfo::Deserialize(const rrlib::xml::tNode& node, bool finstruct_context, bool include_commmand_line)
 {
@@ -108,15 +362,17 @@ void tParameterInfo::Deserialize(const rrlib::xml::tNode& node, bool finstruct_c
   {
     config_entry = "";
   }
+  config_entry_path = tConfigPath(config_entry);
+  value_changed = true;
   if (include_commmand_line)
   {
     if (node.HasAttribute("cmdline"))
     {
-      command_line_option = node.GetStringAttribute("cmdline");
+      SetCommandLineOption(node.GetStringAttribute("cmdline"));
     }
     else
     {
-      command_line_option = "";
+      SetCommandLineOption("");
     }
   }
   if (node.HasAttribute("default"))
@@ -130,6 +386,76 @@ void tParameterInfo::Deserialize(const rrlib::xml::tNode& node, bool finstruct_c
 }
 #endif
 
+void tParameterInfo::DeserializeValue(tPendingLoad& load, bool force_publish)
+{
+  data_ports::tGenericPort port = data_ports::tGenericPort::Wrap(*load.port, true);
+
+  // command line option
+  if (load.command_line_value.length() > 0)
+  {
+    AcquireBuffer(port, load);
+    try
+    {
+      tNumericValueParser::Deserialize(load.command_line_value, *load.buffer);
+      load.source = tPendingLoad::tSource::COMMAND_LINE;
+      return;
+    }
+    catch (const std::exception& e)
+    {
+      FINROC_LOG_PRINT(ERROR, "Failed to load parameter '", load.port->GetQualifiedName(), "' from command line argument '", load.command_line_value, "': ", e);
+    }
+  }
+
+  // config file entry (config file is only locked for reading - ports and config files are deleted deferred)
+  if (load.config_file)
+  {
+    try
+    {
+      // cheap checks first: fingerprint is only calculated if port might still contain value of entry
+      load.modification_count = load.config_file->modification_count.load();
+      bool port_contains_loaded_value = load.same_entry && load.config_file == loaded_config_file && (!value_changed) && (!force_publish);
+      if (port_contains_loaded_value && load.modification_count == loaded_modification_count)
+      {
+        return;  // config file has not been modified since value was loaded
+      }
+      if (port_contains_loaded_value)
+      {
+        load.fingerprint_valid = load.config_file->GetEntryFingerprint(load.config_entry, load.fingerprint);
+        if (load.fingerprint_valid && loaded_fingerprint_valid && load.fingerprint == loaded_fingerprint)
+        {
+          loaded_modification_count = load.modification_count;
+          return;  // port still contains value of unchanged entry
+        }
+      }
+      AcquireBuffer(port, load);
+      if (load.config_file->DeserializeEntry(load.config_entry, *load.buffer))
+      {
+        load.source = tPendingLoad::tSource::CONFIG_FILE;
+        return;
+      }
+    }
+    catch (const std::exception& e)
+    {
+      FINROC_LOG_PRINT(ERROR, "Failed to load parameter '", load.port->GetQualifiedName(), "' from config entry '", load.config_entry.ToString(), "': ", e);
+    }
+  }
+
+  // finstruct default
+  if (load.default_value.length() > 0)
+  {
+    AcquireBuffer(port, load);
+    try
+    {
+      tNumericValueParser::Deserialize(load.default_value, *load.buffer);
+      load.source = tPendingLoad::tSource::FINSTRUCT_DEFAULT;
+    }
+    catch (const std::exception& e)
+    {
+      FINROC_LOG_PRINT(ERROR, "Failed to load parameter '", load.port->GetQualifiedName(), "' from finstruct default '", load.default_value, "': ", e);
+    }
+  }
+}
+
 bool tParameterInfo::IsFinstructableGroupResponsibleForConfigFileConnections(const core::tFrameworkElement& finstructable_group, const core::tFrameworkElement& ap)
 {
   tConfigFile* cf = tConfigFile::Find(ap);
@@ -153,114 +479,178 @@ bool tParameterInfo::IsFinstructableGroupResponsibleForConfigFileConnections(con
   return responsible == &finstructable_group;
 }
 
-void tParameterInfo::LoadValue(bool ignore_ready)
+void tParameterInfo::LoadValue(bool ignore_ready, bool force_publish)
 {
   core::tAbstractPort* ann = this->GetAnnotated<core::tAbstractPort>();
+  if (!ann)
+  {
+    return;
+  }
+
+  // Resolve sources of value while holding structure mutex...
+  std::vector<tPendingLoad> loads(1);
   {
     rrlib::thread::tLock lock(ann->GetStructureMutex());
-    if (ann && (ignore_ready || ann->IsReady()))
+    if (!ResolveValueSources(loads[0], ignore_ready))
+    {
+      return;
+    }
+  }
+
+  // ...and deserialize and publish value without it
+  LoadValues(loads, force_publish);
+}
+
+void tParameterInfo::LoadValues(std::vector<tPendingLoad>& loads, bool force_publish)
+{
+  // Deserialize concurrently if there are enough values - and no config file is locked by this thread
+  // (worker threads could not read it - with exclusive lock, or with shared lock if another thread waits for exclusive lock)
+  tDeserializationPool& pool = tDeserializationPool::GetInstance();
+  size_t helper_count = std::min(pool.GetThreadCount(), loads.size() / cMIN_VALUES_PER_DESERIALIZATION_THREAD);
+  for (auto it = loads.begin(); helper_count > 0 && it != loads.end(); ++it)
+  {
+    if (it->config_file && (it->config_file->access_lock.IsExclusivelyOwned() || it->config_file->access_lock.IsSharedOwned()))
+    {
+      helper_count = 0;
+    }
+  }
+
+  bool deserialized = false;
+  if (helper_count > 0)
+  {
+    // buffers are acquired by this thread. Threads do not parse lazy subtrees (this requires the structure mutex this thread may hold):
+    // subtrees with entries are parsed in ResolveValueSources() - loads of entries in other subtrees (added concurrently) are deferred.
+    for (tPendingLoad & load : loads)
     {
-      // command line option
-      if (command_line_option.length() > 0)
+      load.buffer = data_ports::tGenericPort::Wrap(*load.port, true).GetUnusedBuffer();
+    }
+    std::atomic<size_t> next_index(0);
+    std::function<void()> deserialize = [&loads, &next_index, force_publish]()
+    {
+      bool parse_subtrees_forbidden = tConfigFile::parse_subtrees_forbidden;
+      tConfigFile::parse_subtrees_forbidden = true;
+      size_t index;
+      while ((index = next_index++) < loads.size())
       {
-        std::string arg = core::tRuntimeEnvironment::GetInstance().GetCommandLineArgument(command_line_option);
-        if (arg.length() > 0)
+        try
         {
-          if (data_ports::IsDataFlowType(ann->GetDataType()))
-          {
-            rrlib::serialization::tStringInputStream sis(arg);
-            data_ports::tGenericPort port = data_ports::tGenericPort::Wrap(*ann, true);
-            data_ports::tPortDataPointer<rrlib::rtti::tGenericObject> buffer = port.GetUnusedBuffer();
-            try
-            {
-              buffer->Deserialize(sis);
-              std::string error = port.BrowserPublish(buffer);
-              if (error.size() > 0)
-              {
-                FINROC_LOG_PRINT(WARNING, "Failed to load parameter '", ann->GetQualifiedName(), "' from command line argument '", arg, "': ", error);
-              }
-              return;
-            }
-            catch (const std::exception& e)
-            {
-              FINROC_LOG_PRINT(ERROR, "Failed to load parameter '", ann->GetQualifiedName(), "' from command line argument '", arg, "': ", e);
-            }
-          }
-          else
-          {
-            throw std::runtime_error("Port Type not supported as a parameter");
-          }
+          loads[index].parameter->DeserializeValue(loads[index], force_publish);
         }
-      }
-
-      // config file entry
-      tConfigFile* cf = tConfigFile::Find(*ann);
-      if (cf != NULL && config_entry.length() > 0)
-      {
-        std::string full_config_entry = tConfigNode::GetFullConfigEntry(*ann, config_entry);
-        if (cf->HasEntry(full_config_entry))
+        catch (const tConfigFile::tSubtreesNotParsed&)
         {
-#ifdef _LIB_RRLIB_XML_PRESENT_
-          rrlib::xml::tNode& node = cf->GetEntry(full_config_entry, false);
-          if (data_ports::IsDataFlowType(ann->GetDataType()))
-          {
-            data_ports::tGenericPort port = data_ports::tGenericPort::Wrap(*ann, true);
-            data_ports::tPortDataPointer<rrlib::rtti::tGenericObject> buffer = port.GetUnusedBuffer();
-
-            try
-            {
-              buffer->Deserialize(node);
-              std::string error = port.BrowserPublish(buffer);
-              if (error.size() > 0)
-              {
-                FINROC_LOG_PRINT(WARNING, "Failed to load parameter '", ann->GetQualifiedName(), "' from config entry '", full_config_entry, "': ", error);
-              }
-              return;
-            }
-            catch (const std::exception& e)
-            {
-              FINROC_LOG_PRINT(ERROR, "Failed to load parameter '", ann->GetQualifiedName(), "' from config entry '", full_config_entry, "': ", e);
-            }
-          }
-          else
-          {
-            throw std::runtime_error("Port Type not supported as a parameter");
-          }
-#endif
+          loads[index].source = tPendingLoad::tSource::NONE;
+          loads[index].deferred = true;
         }
       }
+      tConfigFile::parse_subtrees_forbidden = parse_subtrees_forbidden;
+    };
+    deserialized = pool.TryRun(deserialize, helper_count);
+  }
+
+  for (tPendingLoad & load : loads)
+  {
+    if ((!deserialized) || load.deferred)
+    {
+      load.parameter->DeserializeValue(load, force_publish);
+    }
+  }
 
-      // finstruct default
-      if (finstruct_default.length() > 0)
+  std::vector<tChangeEpoch*> epochs;
+  for (tPendingLoad & load : loads)
+  {
+    if (load.source != tPendingLoad::tSource::NONE)
+    {
+      epochs.push_back(load.change_epoch);
+    }
+  }
+  tChangeEpoch::tUpdate update(epochs);
+  for (tPendingLoad & load : loads)
+  {
+    load.parameter->PublishValue(load, force_publish);
+  }
+}
+
+void tParameterInfo::PublishValue(tPendingLoad& load, bool force_publish)
+{
+  if (load.source == tPendingLoad::tSource::NONE)
+  {
+    return;
+  }
+
+  data_ports::tGenericPort port = data_ports::tGenericPort::Wrap(*load.port, true);
+  std::string error = Publish(port, load.buffer, force_publish);
+  if (load.source == tPendingLoad::tSource::CONFIG_FILE)
+  {
+    value_changed = error.size() > 0;  // port now contains value from config file (publishing marked it as changed)
+    loaded_config_file = error.size() > 0 ? NULL : load.config_file;
+    loaded_modification_count = load.modification_count;
+    loaded_fingerprint = load.fingerprint;
+    loaded_fingerprint_valid = load.fingerprint_valid;
+  }
+  else
+  {
+    loaded_config_file = NULL;
+  }
+
+  if (error.size() > 0)
+  {
+    if (load.source == tPendingLoad::tSource::COMMAND_LINE)
+    {
+      FINROC_LOG_PRINT(WARNING, "Failed to load parameter '", load.port->GetQualifiedName(), "' from command line argument '", load.command_line_value, "': ", error);
+    }
+    else if (load.source == tPendingLoad::tSource::CONFIG_FILE)
+    {
+      FINROC_LOG_PRINT(WARNING, "Failed to load parameter '", load.port->GetQualifiedName(), "' from config entry '", load.config_entry.ToString(), "': ", error);
+    }
+    else
+    {
+      FINROC_LOG_PRINT(WARNING, "Failed to load parameter '", load.port->GetQualifiedName(), "' from finstruct default '", load.default_value, "': ", error);
+    }
+  }
+}
+
+bool tParameterInfo::ResolveValueSources(tPendingLoad& load, bool ignore_ready)
+{
+  core::tAbstractPort* ann = this->GetAnnotated<core::tAbstractPort>();
+  if (!(ann && (ignore_ready || ann->IsReady())))
+  {
+    return false;
+  }
+  load.parameter = this;
+  load.port = ann;
+  load.change_epoch = tChangeEpoch::Find(*ann);
+  if (!command_line_value)
+  {
+    command_line_value = tCommandLineIndex::Resolve(command_line_option);
+  }
+  if (command_line_value)
+  {
+    load.command_line_value = *command_line_value;
+  }
+  if (config_entry.length() > 0)
+  {
+    load.config_file = tConfigFile::Find(*ann);
+    if (load.config_file)
+    {
+      tConfigNode::GetFullConfigEntry(*ann, config_entry_path, load.config_entry);
+      load.same_entry = load.config_entry == full_config_entry_path;
+      full_config_entry_path = load.config_entry;
+      if (!load.config_file->HasEntry(load.config_entry))  // also parses any lazily loaded subtree containing entry now - so that deserializing requires no structure mutex
       {
-        if (data_ports::IsDataFlowType(ann->GetDataType()))
-        {
-          rrlib::serialization::tStringInputStream sis(finstruct_default);
-          data_ports::tGenericPort port = data_ports::tGenericPort::Wrap(*ann, true);
-          data_ports::tPortDataPointer<rrlib::rtti::tGenericObject> buffer = port.GetUnusedBuffer();
-
-          try
-          {
-            buffer->Deserialize(sis);
-            std::string error = port.BrowserPublish(buffer);
-            if (error.size() > 0)
-            {
-              FINROC_LOG_PRINT(WARNING, "Failed to load parameter '", ann->GetQualifiedName(), "' from finstruct default '", finstruct_default, "': ", error);
-            }
-            return;
-          }
-          catch (const std::exception& e)
-          {
-            FINROC_LOG_PRINT(ERROR, "Failed to load parameter '", ann->GetQualifiedName(), "' from finstruct default '", finstruct_default, "': ", e);
-          }
-        }
-        else
-        {
-          throw std::runtime_error("Port Type not supported as a parameter");
-        }
+        load.config_file = nullptr;  // no entry to load value from
       }
     }
   }
+  load.default_value = finstruct_default;
+  if (load.command_line_value.empty() && load.config_file == NULL && load.default_value.empty())
+  {
+    return false;
+  }
+  if (!data_ports::IsDataFlowType(ann->GetDataType()))
+  {
+    throw std::runtime_error("Port Type not supported as a parameter");
+  }
+  return true;
 }
 
 void tParameterInfo::SaveValue()
@@ -271,33 +661,35 @@ void tParameterInfo::SaveValue()
     return;
   }
   tConfigFile* cf = tConfigFile::Find(*ann);
-  bool has_entry = cf->HasEntry(config_entry);
+  bool has_entry = cf->HasEntry(config_entry_path);
   if (data_ports::IsDataFlowType(ann->GetDataType()))
   {
     data_ports::tGenericPort port = data_ports::tGenericPort::Wrap(*ann, true);
     if (has_entry)
     {
-      // Does port contain default value?
+      value_changed = false;  // reset before obtaining value - so that any concurrent change is not lost
+      std::unique_ptr<rrlib::rtti::tGenericObject> current_value(port.GetDataType().CreateInstanceGeneric());
+      port.Get(*current_value);
+
+      // Does port contain default value? (then nothing is written - so value is still to be saved)
       const rrlib::rtti::tGenericObject* default_value = port.GetDefaultValue();
-      bool is_default = false;
-      if (default_value)
+      bool is_default = default_value && current_value->Equals(*default_value);
+      if (is_default)
       {
-        std::unique_ptr<rrlib::rtti::tGenericObject> current_value(default_value->GetType().CreateInstanceGeneric());
-        port.Get(*current_value);
-        if (current_value->Equals(*default_value))
-        {
-          is_default = true;
-        }
+        // port no longer contains value loaded from entry (which is not overwritten) - so entry must be loaded again on next load
+        value_changed = true;
+        loaded_config_file = nullptr;
+        loaded_fingerprint_valid = false;
+        return;
       }
-
-      if (!is_default)
+      try
       {
-#ifdef _LIB_RRLIB_XML_PRESENT_
-        rrlib::xml::tNode& node = cf->GetEntry(config_entry, true);
-        std::unique_ptr<rrlib::rtti::tGenericObject> current_value(port.GetDataType().CreateInstanceGeneric());
-        port.Get(*current_value);
-        current_value->Serialize(node);
-#endif
+        cf->SerializeEntry(config_entry_path, *current_value);
+      }
+      catch (...)
+      {
+        value_changed = true;
+        throw;
       }
     }
   }
@@ -334,7 +726,9 @@ void tParameterInfo::SetConfigEntry(const std::string& config_entry, bool finstr
   if (this->config_entry.compare(config_entry) != 0)
   {
     this->config_entry = config_entry;
+    this->config_entry_path = tConfigPath(config_entry);
     this->entry_set_from_finstruct = finstruct_set;
+    this->value_changed = true;
     try
     {
       LoadValue();
@@ -366,7 +760,12 @@ rrlib::serialization::tInputStream& operator >> (rrlib::serialization::tInputStr
               command_line_option_tmp.compare(parameter_info.GetCommandLineOption()) == 0 &&
               finstruct_default_tmp.compare(parameter_info.GetFinstructDefault()) == 0;
   parameter_info.config_entry = config_entry_tmp;
-  parameter_info.command_line_option = command_line_option_tmp;
+  parameter_info.config_entry_path = tConfigPath(config_entry_tmp);
+  if (!same)
+  {
+    parameter_info.value_changed = true;
+  }
+  parameter_info.SetCommandLineOption(command_line_option_tmp);
   parameter_info.finstruct_default = finstruct_default_tmp;
 
   if (!same)
@@ -42,10 +42,15 @@
 //----------------------------------------------------------------------
 #include "rrlib/serialization/serialization.h"
 #include "core/tFrameworkElement.h"
+#include "plugins/data_ports/tGenericPort.h"
+#include <atomic>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/parameters/tConfigFile.h"
+#include "plugins/parameters/internal/tChangeEpoch.h"
+#include "plugins/parameters/internal/tCommandLineIndex.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -77,8 +82,76 @@ class tParameterInfo : public core::tAnnotation
 //----------------------------------------------------------------------
 public:
 
+  /*!
+   * Pending load of a parameter value.
+   * Its sources are resolved while holding the structure mutex (see ResolveValueSources()).
+   * The value is then deserialized and published without it - so the time
+   * the structure mutex is held does not depend on the size of values.
+   */
+  struct tPendingLoad
+  {
+    /*! Source that value was deserialized from */
+    enum class tSource
+    {
+      NONE,
+      COMMAND_LINE,
+      CONFIG_FILE,
+      FINSTRUCT_DEFAULT
+    };
+
+    /*! Parameter and its port */
+    tParameterInfo* parameter;
+    core::tAbstractPort* port;
+
+    /*! Value of command line argument and finstruct default (empty if not set) */
+    std::string command_line_value, default_value;
+
+    /*! Config file and full config entry to load value from (config file is null if there is none - or it has no such entry) */
+    tConfigFile* config_file;
+    tConfigPath config_entry;
+
+    /*! Same full config entry as on last load? */
+    bool same_entry;
+
+    /*! Deserialized value and its source (NONE if nothing needs to be published) */
+    tSource source;
+    data_ports::tPortDataPointer<rrlib::rtti::tGenericObject> buffer;
+
+    /*! Modification count of config file before entry was read (see tConfigFile::modification_count) */
+    uint64_t modification_count;
+
+    /*! Fingerprint of config entry's content (only calculated if value might not need to be loaded - see fingerprint_valid) */
+    uint64_t fingerprint;
+    bool fingerprint_valid;
+
+    /*! Change epoch of parameter's value (null if there is none) */
+    tChangeEpoch* change_epoch;
+
+    /*! Could value not be deserialized concurrently? (then it is deserialized by the thread calling LoadValues()) */
+    bool deferred;
+
+    tPendingLoad() :
+      parameter(nullptr),
+      port(nullptr),
+      command_line_value(),
+      default_value(),
+      config_file(nullptr),
+      config_entry(),
+      same_entry(false),
+      source(tSource::NONE),
+      buffer(),
+      modification_count(0),
+      fingerprint(0),
+      fingerprint_valid(false),
+      change_epoch(nullptr),
+      deferred(false)
+    {}
+  };
+
   tParameterInfo();
 
+  virtual ~tParameterInfo();
+
 #ifdef _LIB_RRLIB_XML_PRESENT_
   void Deserialize(const rrlib::xml::tNode& node, bool finstruct_context, bool include_commmand_line);
 #endif
@@ -146,8 +219,40 @@ public:
    * load value from configuration file
    *
    * \param ignore ready flag?
+   * \param force_publish Publish value even if port already contains it? (by default, such no-op publishes are suppressed - so listeners are not notified)
    */
-  void LoadValue(bool ignore_ready);
+  void LoadValue(bool ignore_ready, bool force_publish = false);
+
+  /*!
+   * Deserializes and publishes values of pending loads (second phase of loading values).
+   * Should be called without holding the structure mutex.
+   * If there are many values, they are deserialized concurrently (by the calling thread and a bounded pool of threads)
+   * - and then published in order by the calling thread.
+   * All values are published within one change epoch (see tParameterTransaction).
+   *
+   * \param loads Pending loads whose sources were resolved with ResolveValueSources()
+   * \param force_publish Publish values even if ports already contain them?
+   */
+  static void LoadValues(std::vector<tPendingLoad>& loads, bool force_publish = false);
+
+  /*!
+   * Called whenever value of parameter port changes
+   * (marks value as changed since it was last loaded from or saved to configuration file)
+   */
+  void OnPortChange(data_ports::tChangeContext& change_context)
+  {
+    value_changed = true;
+  }
+
+  /*!
+   * Resolves sources of parameter's value (first phase of loading value).
+   * Must be called while holding the structure mutex.
+   *
+   * \param load Pending load to fill
+   * \param ignore_ready Ignore ready flag?
+   * \return True if value needs to be loaded (false if there is no source or port is not ready)
+   */
+  bool ResolveValueSources(tPendingLoad& load, bool ignore_ready);
 
   /*!
    * save value to configuration file
@@ -155,6 +260,15 @@ public:
    */
   void SaveValue();
 
+  /*!
+   * \return Has value changed since it was last loaded from or saved to configuration file?
+   * (only parameters with changed values need to be saved)
+   */
+  bool ValueChanged() const
+  {
+    return value_changed;
+  }
+
 #ifdef _LIB_RRLIB_XML_PRESENT_
   void Serialize(rrlib::xml::tNode& node, bool finstruct_context, bool include_command_line) const;
 #endif
@@ -166,6 +280,7 @@ public:
   void SetCommandLineOption(const std::string& command_line_option)
   {
     this->command_line_option = command_line_option;
+    command_line_value = nullptr;  // resolved when value is loaded
   }
 
   /*!
@@ -190,6 +305,7 @@ public:
 //----------------------------------------------------------------------
 private:
 
+  friend class parameters::tConfigFile;
   friend rrlib::serialization::tOutputStream& operator << (rrlib::serialization::tOutputStream& stream, const tParameterInfo& parameter_info);
   friend rrlib::serialization::tInputStream& operator >> (rrlib::serialization::tInputStream& stream, tParameterInfo& parameter_info);
 
@@ -199,6 +315,12 @@ private:
    */
   std::string config_entry;
 
+  /*! Config entry as pre-tokenized path */
+  tConfigPath config_entry_path;
+
+  /*! Full config entry (including config node) - buffer reused on every load */
+  tConfigPath full_config_entry_path;
+
   /*! Was config entry set from finstruct? */
   bool entry_set_from_finstruct;
 
@@ -208,14 +330,48 @@ private:
    */
   std::string command_line_option;
 
+  /*! Value of command line argument for command_line_option (null if it was not found yet - see tCommandLineIndex) */
+  const std::string* command_line_value;
+
   /*!
    * Default value set in finstruct (optional)
    * (set by finstructable group responsible for connecting this parameter to attribute tree)
    */
   std::string finstruct_default;
 
+  /*! Config file whose parameter registry this parameter is contained in (null if none) */
+  tConfigFile* registered_config_file;
+
+  /*! Next and previous parameter in parameter registry of config file (intrusive list) */
+  tParameterInfo* next_registered, *previous_registered;
+
+  /*! Has value changed since it was last loaded from or saved to configuration file? */
+  std::atomic<bool> value_changed;
+
+  /*!
+   * Config file that current value was loaded from (null if value was not loaded from a config file),
+   * its modification count, and fingerprint of entry's content at that time (if calculated).
+   * If neither entry, config file (or at least entry's content), nor the port's value changed, loading is skipped.
+   */
+  tConfigFile* loaded_config_file;
+  uint64_t loaded_modification_count;
+  uint64_t loaded_fingerprint;
+  bool loaded_fingerprint_valid;
+
+  /*!
+   * Deserializes value of pending load from the first source that can be deserialized
+   * (does not require structure mutex)
+   */
+  void DeserializeValue(tPendingLoad& load, bool force_publish);
+
+  /*!
+   * Publishes value deserialized by DeserializeValue()
+   */
+  void PublishValue(tPendingLoad& load, bool force_publish);
 
   virtual void AnnotatedObjectInitialized() override;
+
+  virtual void AnnotatedObjectToBeDeleted() override;
 };
 
 rrlib::serialization::tOutputStream& operator << (rrlib::serialization::tOutputStream& stream, const tParameterInfo& parameter_info);
@@ -0,0 +1,162 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tReadWriteLock.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tReadWriteLock.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tReadWriteLock::tReadWriteLock() :
+  mutex(),
+  released(),
+  shared_owners(0),
+  waiting_writers(0),
+  exclusive_owner(std::thread::id())
+{}
+
+bool tReadWriteLock::IsSharedOwned() const
+{
+  const std::vector<const tReadWriteLock*>& shared_locks = SharedLocksOfCurrentThread();
+  return std::find(shared_locks.begin(), shared_locks.end(), this) != shared_locks.end();
+}
+
+bool tReadWriteLock::LockExclusive()
+{
+  std::thread::id current_thread = std::this_thread::get_id();
+  if (exclusive_owner.load() == current_thread)
+  {
+    return false;
+  }
+  assert(!IsSharedOwned() && "Upgrading shared lock to exclusive lock would deadlock");
+  std::unique_lock<std::mutex> lock(mutex);
+  waiting_writers++;
+  released.wait(lock, [this]()
+  {
+    return shared_owners == 0 && exclusive_owner.load() == std::thread::id();
+  });
+  waiting_writers--;
+  exclusive_owner = current_thread;
+  return true;
+}
+
+bool tReadWriteLock::LockShared()
+{
+  if (IsExclusivelyOwned() || IsSharedOwned())
+  {
+    return false;
+  }
+  std::unique_lock<std::mutex> lock(mutex);
+  released.wait(lock, [this]()
+  {
+    return exclusive_owner.load() == std::thread::id() && waiting_writers == 0;
+  });
+  shared_owners++;
+  SharedLocksOfCurrentThread().push_back(this);
+  return true;
+}
+
+std::vector<const tReadWriteLock*>& tReadWriteLock::SharedLocksOfCurrentThread()
+{
+  static thread_local std::vector<const tReadWriteLock*> shared_locks;
+  return shared_locks;
+}
+
+void tReadWriteLock::UnlockExclusive()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    assert(IsExclusivelyOwned());
+    exclusive_owner = std::thread::id();
+  }
+  released.notify_all();
+}
+
+void tReadWriteLock::UnlockShared()
+{
+  std::vector<const tReadWriteLock*>& shared_locks = SharedLocksOfCurrentThread();
+  auto it = std::find(shared_locks.begin(), shared_locks.end(), this);
+  assert(it != shared_locks.end());
+  shared_locks.erase(it);
+
+  bool notify = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    assert(shared_owners > 0);
+    shared_owners--;
+    notify = shared_owners == 0;
+  }
+  if (notify)
+  {
+    released.notify_all();
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,197 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tReadWriteLock.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tReadWriteLock
+ *
+ * \b tReadWriteLock
+ *
+ * Reader-writer lock that is reentrant for the thread with exclusive access.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__parameters__internal__tReadWriteLock_h__
+#define __plugins__parameters__internal__tReadWriteLock_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Reader-writer lock
+/*!
+ * Reader-writer lock that is reentrant for the thread with exclusive access:
+ * This thread may acquire further shared and exclusive locks (they have no effect).
+ * Shared locks may be nested as well (nested shared locks of a thread have no effect).
+ *
+ * Writers are preferred: while a thread waits for the exclusive lock, no further threads acquire shared locks
+ * (so writers are not starved by a continuous stream of readers).
+ * A thread holding only a shared lock must not acquire an exclusive lock (this would deadlock - and is asserted).
+ *
+ * Locks are acquired via tSharedLock and tExclusiveLock.
+ */
+class tReadWriteLock : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Acquires shared lock for the lifetime of this object */
+  class tSharedLock : private rrlib::util::tNoncopyable
+  {
+  public:
+    explicit tSharedLock(tReadWriteLock& lock) :
+      lock(lock),
+      acquired(lock.LockShared())
+    {}
+
+    ~tSharedLock()
+    {
+      if (acquired)
+      {
+        lock.UnlockShared();
+      }
+    }
+
+  private:
+    tReadWriteLock& lock;
+    bool acquired;
+  };
+
+  /*! Acquires exclusive lock for the lifetime of this object */
+  class tExclusiveLock : private rrlib::util::tNoncopyable
+  {
+  public:
+    explicit tExclusiveLock(tReadWriteLock& lock) :
+      lock(lock),
+      acquired(lock.LockExclusive())
+    {}
+
+    ~tExclusiveLock()
+    {
+      if (acquired)
+      {
+        lock.UnlockExclusive();
+      }
+    }
+
+  private:
+    tReadWriteLock& lock;
+    bool acquired;
+  };
+
+  tReadWriteLock();
+
+  /*!
+   * \return Does the current thread hold the exclusive lock?
+   */
+  bool IsExclusivelyOwned() const
+  {
+    return exclusive_owner.load() == std::this_thread::get_id();
+  }
+
+  /*!
+   * \return Does the current thread hold a shared lock (and not the exclusive lock)?
+   */
+  bool IsSharedOwned() const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Mutex for state */
+  std::mutex mutex;
+
+  /*! Notified whenever lock is released */
+  std::condition_variable released;
+
+  /*! Number of threads holding shared lock */
+  size_t shared_owners;
+
+  /*! Number of threads waiting for exclusive lock */
+  size_t waiting_writers;
+
+  /*! Thread holding exclusive lock (default-constructed id if none) */
+  std::atomic<std::thread::id> exclusive_owner;
+
+  /*!
+   * \return True if lock was acquired - false if current thread already holds exclusive lock
+   */
+  bool LockExclusive();
+
+  /*!
+   * \return True if lock was acquired - false if current thread already holds exclusive or shared lock
+   */
+  bool LockShared();
+
+  /*!
+   * \return Locks that the current thread holds shared locks of
+   */
+  static std::vector<const tReadWriteLock*>& SharedLocksOfCurrentThread();
+
+  void UnlockExclusive();
+
+  void UnlockShared();
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
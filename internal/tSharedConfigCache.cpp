@@ -0,0 +1,210 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tSharedConfigCache.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tSharedConfigCache.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <stdexcept>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+constexpr const char* tSharedConfigCache::cCACHE_DIRECTORY;
+
+/*! Prefix of names of cache files (followed by effective user id - so that every user has own cache files) */
+static const std::string cFILE_PREFIX = "finroc_config_";
+
+/*!
+ * XML files modified less than this number of seconds ago are not cached
+ * (file could be modified again without changing its modification time on file systems with coarse time stamps)
+ */
+static const time_t cMIN_FILE_AGE = 2;
+
+/*! FNV-1a offset basis and prime */
+static const uint64_t cFNV_OFFSET_BASIS = 14695981039346656037ULL;
+static const uint64_t cFNV_PRIME = 1099511628211ULL;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * Updates FNV-1a hash with data
+ *
+ * \param hash Hash to update
+ * \param data Data
+ * \param size Size of data
+ */
+static void Hash(uint64_t& hash, const void* data, size_t size)
+{
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < size; i++)
+  {
+    hash = (hash ^ bytes[i]) * cFNV_PRIME;
+  }
+}
+
+/*!
+ * \param hash Hash value
+ * \return Hash value as hex string
+ */
+static std::string ToHex(uint64_t hash)
+{
+  char buffer[17];
+  snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(hash));
+  return buffer;
+}
+
+/*!
+ * \param cache_file Cache file
+ * \return Prefix of names of all cache files of the same XML file
+ */
+static std::string GetFilePrefix(const std::string& cache_file)
+{
+  size_t name_start = cache_file.rfind('/') + 1;
+  return cache_file.substr(name_start, cache_file.rfind('_') + 1 - name_start);  // prefix, user id, path hash, and '_'
+}
+
+/*!
+ * \param file File in cache directory
+ * \return True if file is a regular file owned by the effective user
+ */
+static bool IsOwnFile(const std::string& file)
+{
+  struct stat file_info;
+  return lstat(file.c_str(), &file_info) == 0 && S_ISREG(file_info.st_mode) && file_info.st_uid == geteuid();
+}
+
+std::unique_ptr<tCompiledConfig> tSharedConfigCache::Attach(const std::string& cache_file)
+{
+  if (cache_file.empty() || access(cache_file.c_str(), F_OK) != 0)
+  {
+    return std::unique_ptr<tCompiledConfig>();
+  }
+  return std::unique_ptr<tCompiledConfig>(new tCompiledConfig(cache_file, true));
+}
+
+std::string tSharedConfigCache::GetCacheFile(const std::string& file)
+{
+  struct stat directory_info, file_info;
+  if (stat(cCACHE_DIRECTORY, &directory_info) != 0 || (!S_ISDIR(directory_info.st_mode)) || stat(file.c_str(), &file_info) != 0 ||
+      file_info.st_mtim.tv_sec > time(nullptr) - cMIN_FILE_AGE)
+  {
+    return "";
+  }
+  char* real_path = realpath(file.c_str(), nullptr);
+  if (!real_path)
+  {
+    return "";
+  }
+  uint64_t path_hash = cFNV_OFFSET_BASIS;
+  Hash(path_hash, real_path, strlen(real_path));
+  free(real_path);
+
+  // key on file state instead of content (so file need not be read to attach):
+  // the change time is updated on every modification and - unlike the modification time - cannot be set by user processes
+  uint64_t state_hash = cFNV_OFFSET_BASIS;
+  int64_t file_state[7] = { static_cast<int64_t>(file_info.st_dev), static_cast<int64_t>(file_info.st_ino), static_cast<int64_t>(file_info.st_size),
+                            static_cast<int64_t>(file_info.st_mtim.tv_sec), static_cast<int64_t>(file_info.st_mtim.tv_nsec),
+                            static_cast<int64_t>(file_info.st_ctim.tv_sec), static_cast<int64_t>(file_info.st_ctim.tv_nsec)
+                          };
+  Hash(state_hash, file_state, sizeof(file_state));
+
+  return std::string(cCACHE_DIRECTORY) + "/" + cFILE_PREFIX + std::to_string(geteuid()) + "_" + ToHex(path_hash) + "_" + ToHex(state_hash) + tCompiledConfig::cFILE_EXTENSION;
+}
+
+void tSharedConfigCache::Publish(const std::string& cache_file, std::vector<tConfigBackend::tEntry>& entries)
+{
+  // image is written to temporary file that is renamed (so other processes never attach to an incomplete image);
+  // readable only by this user (other users' images are never attached to - see Attach())
+  tCompiledConfig::Write(cache_file, entries, std::string(), 0600);
+
+  // remove images of previous versions (processes attached to them keep their mappings)
+  std::string prefix = GetFilePrefix(cache_file);
+  std::string name = cache_file.substr(cache_file.rfind('/') + 1);
+  DIR* directory = opendir(cCACHE_DIRECTORY);
+  if (directory)
+  {
+    while (dirent* directory_entry = readdir(directory))
+    {
+      std::string other = directory_entry->d_name;
+      std::string other_file = std::string(cCACHE_DIRECTORY) + "/" + other;
+      if (other.compare(0, prefix.length(), prefix) == 0 && other != name && other.find(".tmp") == std::string::npos && IsOwnFile(other_file))
+      {
+        unlink(other_file.c_str());
+      }
+    }
+    closedir(directory);
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,128 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tSharedConfigCache.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tSharedConfigCache
+ *
+ * \b tSharedConfigCache
+ *
+ * Cache of compiled config files in shared memory - shared by all processes on a host.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__parameters__internal__tSharedConfigCache_h__
+#define __plugins__parameters__internal__tSharedConfigCache_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <memory>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tCompiledConfig.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Shared config cache
+/*!
+ * Cache of compiled config files (see tCompiledConfig) in shared memory.
+ *
+ * The first process that loads an XML config file publishes a compiled image of it.
+ * Other processes on the same host attach to this image (memory-mapped read-only)
+ * instead of parsing the XML file - so the pages are shared by all of them.
+ *
+ * Images are keyed by user, path and file state (inode, size, modification and change time) of the XML file.
+ * Hence, modified files are never served from outdated images - without reading XML files to attach.
+ * Files modified within the last seconds are not cached (their time stamps might not change on further modifications).
+ *
+ * Images are created with O_EXCL and mode 0600. Only images owned by the effective user that are not writable
+ * by others are attached to, and only own images are removed.
+ */
+class tSharedConfigCache
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Directory that images are placed in (shared memory file system) */
+  static constexpr const char* cCACHE_DIRECTORY = "/dev/shm";
+
+  /*!
+   * Attaches to cached image
+   *
+   * \param cache_file Cache file of XML file (see GetCacheFile())
+   * \return Compiled config file - or nullptr if no image has been published yet
+   *
+   * \throw Throws std::runtime_error if image is invalid or not owned by this user
+   */
+  static std::unique_ptr<tCompiledConfig> Attach(const std::string& cache_file);
+
+  /*!
+   * \param file XML file (existing file - not file name relative to finroc search paths)
+   * \return Name of cache file for current state of specified file (empty if shared memory file system is not available or file is not to be cached)
+   */
+  static std::string GetCacheFile(const std::string& file);
+
+  /*!
+   * Publishes image (replaces images of any previous versions of the same XML file)
+   *
+   * \param cache_file Cache file of XML file (see GetCacheFile())
+   * \param entries Entries of XML file (sorted during call)
+   *
+   * \throw Throws std::runtime_error if publishing fails
+   */
+  static void Publish(const std::string& cache_file, std::vector<tConfigBackend::tEntry>& entries);
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
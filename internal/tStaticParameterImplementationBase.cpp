@@ -41,6 +41,8 @@
 #include "plugins/parameters/tConfigNode.h"
 #include "plugins/parameters/internal/tStaticParameterList.h"
 #include "plugins/parameters/internal/tParameterInfo.h"
+#include "plugins/parameters/internal/tNumericValueParser.h"
+#include "plugins/parameters/internal/tCommandLineIndex.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -83,9 +85,12 @@ tStaticParameterImplementationBase::tStaticParameterImplementationBase(const std
   parent_list(NULL),
   list_index(0),
   command_line_option(),
+  command_line_value(nullptr),
   outer_parameter_attachment(),
   create_outer_parameter(false),
   config_entry(config_entry),
+  config_entry_path(config_entry),
+  full_config_entry_path(),
   config_entry_set_by_finstruct(false),
   static_parameter_proxy(static_parameter_proxy),
   attached_parameters(),
@@ -277,21 +282,21 @@ void tStaticParameterImplementationBase::LoadValue()
   {
     // command line
     core::tFrameworkElement* fg = parent->GetParentWithFlags(core::tFrameworkElement::tFlag::FINSTRUCTABLE_GROUP);
-    if (command_line_option.length() > 0 && (fg == NULL || fg->GetParent() == &core::tRuntimeEnvironment::GetInstance()))
+    if (!command_line_value)
+    {
+      command_line_value = tCommandLineIndex::Resolve(command_line_option);
+    }
+    if (command_line_value && (fg == NULL || fg->GetParent() == &core::tRuntimeEnvironment::GetInstance()))
     {
       // outermost group?
-      std::string arg = core::tRuntimeEnvironment::GetInstance().GetCommandLineArgument(command_line_option);
-      if (arg.length() > 0)
+      try
       {
-        try
-        {
-          Set(arg);
-          return;
-        }
-        catch (std::exception& e)
-        {
-          FINROC_LOG_PRINT(ERROR, "Failed to load parameter '", GetName(), "' from command line argument '", arg, "': ", e);
-        }
+        Set(*command_line_value);
+        return;
+      }
+      catch (std::exception& e)
+      {
+        FINROC_LOG_PRINT(ERROR, "Failed to load parameter '", GetName(), "' from command line argument '", *command_line_value, "': ", e);
       }
     }
 
@@ -306,23 +311,19 @@ void tStaticParameterImplementationBase::LoadValue()
         }
       }
       tConfigFile* cf = tConfigFile::Find(*parent);
-      std::string full_config_entry = tConfigNode::GetFullConfigEntry(*parent, config_entry);
       if (cf != NULL)
       {
-        if (cf->HasEntry(full_config_entry))
+        tConfigNode::GetFullConfigEntry(*parent, config_entry_path, full_config_entry_path);
+        try
         {
-#ifdef _LIB_RRLIB_XML_PRESENT_
-          rrlib::xml::tNode& node = cf->GetEntry(full_config_entry, false);
-          try
+          if (cf->DeserializeEntry(full_config_entry_path, *value))
           {
-            value->Deserialize(node);
             NotifyChange();
           }
-          catch (std::exception& e)
-          {
-            FINROC_LOG_PRINT(ERROR, "Failed to load parameter '", GetName(), "' from config entry '", full_config_entry, "': ", e);
-          }
-#endif
+        }
+        catch (std::exception& e)
+        {
+          FINROC_LOG_PRINT(ERROR, "Failed to load parameter '", GetName(), "' from config entry '", full_config_entry_path.ToString(), "': ", e);
         }
       }
     }
@@ -415,8 +416,7 @@ void tStaticParameterImplementationBase::Set(const std::string& s)
     val = ValuePointer();
   }
 
-  rrlib::serialization::tStringInputStream sis(s);
-  val->Deserialize(sis);
+  tNumericValueParser::Deserialize(s, *val);
   NotifyChange();
 }
 
@@ -426,6 +426,7 @@ void tStaticParameterImplementationBase::SetConfigEntry(const std::string& confi
   if (config_entry.compare(this->config_entry) != 0)
   {
     this->config_entry = config_entry;
+    this->config_entry_path = tConfigPath(config_entry);
     if (GetParentList() && GetParentList()->GetAnnotated() && GetParentList()->GetAnnotated()->IsReady())
     {
       LoadValue();
@@ -447,7 +448,12 @@ void tStaticParameterImplementationBase::UpdateAndPossiblyLoad(const std::string
   bool cmdline_changed = command_line_option.compare(command_line_option_tmp) != 0;
   bool config_entry_changed = config_entry.compare(config_entry_tmp) != 0;
   command_line_option = command_line_option_tmp;
+  command_line_value = nullptr;  // resolved when value is loaded
   config_entry = config_entry_tmp;
+  if (config_entry_changed)
+  {
+    config_entry_path = tConfigPath(config_entry);
+  }
 
   if (use_value_of == this && (cmdline_changed || config_entry_changed))
   {
@@ -45,6 +45,7 @@
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "plugins/parameters/definitions.h"
+#include "plugins/parameters/internal/tConfigPath.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -128,6 +129,14 @@ public:
     return config_entry;
   }
 
+  /*!
+   * \return Full config entry (including config node) that value was last loaded from (empty if none)
+   */
+  const tConfigPath& GetFullConfigEntryPath() const
+  {
+    return full_config_entry_path;
+  }
+
   const char* GetLogDescription()
   {
     return name.c_str();
@@ -274,6 +283,9 @@ private:
    */
   std::string command_line_option;
 
+  /*! Value of command line argument for command_line_option (null if it was not found yet - see tCommandLineIndex) */
+  const std::string* command_line_value;
+
   /*!
    * Name of outer parameter if parameter is configured by static parameter of finstructable group
    * (usually set by finstructable group containing module with this parameter)
@@ -290,6 +302,12 @@ private:
    */
   std::string config_entry;
 
+  /*! Config entry as pre-tokenized path */
+  tConfigPath config_entry_path;
+
+  /*! Full config entry (including config node) - buffer reused on every load */
+  tConfigPath full_config_entry_path;
+
   /*! Was configEntry set by finstruct? */
   bool config_entry_set_by_finstruct;
 
@@ -76,11 +76,15 @@ static rrlib::rtti::tDataType<tStaticParameterList> cTYPE;
 
 tStaticParameterList::tStaticParameterList() :
   parameters(),
-  create_action(-1)
+  create_action(-1),
+  registered_config_file(nullptr),
+  next_registered(nullptr),
+  previous_registered(nullptr)
 {}
 
 tStaticParameterList::~tStaticParameterList()
 {
+  tConfigFile::UnregisterStaticParameters(*this);
   Clear();
 }
 
@@ -93,6 +97,11 @@ void tStaticParameterList::Add(tStaticParameterImplementationBase& param)
 
 void tStaticParameterList::AnnotatedObjectInitialized()
 {
+  tConfigFile* config_file = tConfigFile::Find(*GetAnnotated());
+  if (config_file)
+  {
+    config_file->RegisterStaticParameters(*this);
+  }
   DoStaticParameterEvaluation(*GetAnnotated());
 }
 
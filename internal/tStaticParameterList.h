@@ -46,6 +46,7 @@
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/parameters/tConfigFile.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -174,6 +175,8 @@ public:
 //----------------------------------------------------------------------
 private:
 
+  friend class parameters::tConfigFile;
+
   /*! List of parameters */
   std::vector<tStaticParameterImplementationBase*> parameters;
 
@@ -183,6 +186,12 @@ private:
    */
   int create_action;
 
+  /*! Config file whose registry this list is contained in (null if none) */
+  tConfigFile* registered_config_file;
+
+  /*! Next and previous list in registry of config file (intrusive list) */
+  tStaticParameterList* next_registered, *previous_registered;
+
 
   /*! Clear list (deletes parameters) */
   void Clear();
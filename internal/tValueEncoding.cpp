@@ -0,0 +1,272 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tValueEncoding.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tValueEncoding.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/serialization/serialization.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const char* tValueEncoding::cATTRIBUTE = "encoding";
+const char* tValueEncoding::cBINARY_BASE64 = "binary-base64";
+const char* tValueEncoding::cFORMAT_ATTRIBUTE = "format";
+
+/*! Base64 alphabet */
+static const char* cBASE64_CHARACTERS = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/*! Name of attribute with data type of binary data */
+static const char* cTYPE_ATTRIBUTE = "type";
+
+/*!
+ * Version of binary format.
+ * Must be incremented whenever the binary form of values changes
+ * (e.g. with incompatible changes to rrlib_serialization).
+ */
+static const char* cBINARY_FORMAT_VERSION = "1";
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+std::string tValueEncoding::DecodeBase64(const std::string& base64)
+{
+  static int8_t values[256];
+  static bool values_initialized = []()
+  {
+    std::fill(values, values + 256, -1);
+    for (int i = 0; i < 64; i++)
+    {
+      values[static_cast<unsigned char>(cBASE64_CHARACTERS[i])] = static_cast<int8_t>(i);
+    }
+    return true;
+  }();
+  (void)values_initialized;
+
+  std::string result;
+  result.reserve(base64.length() * 3 / 4);
+  uint32_t bits = 0;
+  int bit_count = 0;
+  size_t character_count = 0, padding_count = 0;
+  for (char c : base64)
+  {
+    if (c == ' ' || c == '\n' || c == '\r' || c == '\t')
+    {
+      continue;
+    }
+    character_count++;
+    if (c == '=')
+    {
+      padding_count++;
+      continue;
+    }
+    int8_t value = values[static_cast<unsigned char>(c)];
+    if (value < 0 || padding_count)
+    {
+      throw std::runtime_error("Invalid base64 data");
+    }
+    bits = (bits << 6) | static_cast<uint32_t>(value);
+    bit_count += 6;
+    if (bit_count >= 8)
+    {
+      bit_count -= 8;
+      result.push_back(static_cast<char>((bits >> bit_count) & 0xFF));
+    }
+  }
+
+  // data must consist of complete (padded) groups of four characters - and unused bits of the last group must be zero
+  if (character_count % 4 != 0 || padding_count > 2 || (bits & ((1u << bit_count) - 1)) != 0)
+  {
+    throw std::runtime_error("Invalid base64 data");
+  }
+  return result;
+}
+
+std::string tValueEncoding::GetBinaryFormat()
+{
+  const uint16_t byte_order_mark = 1;
+  uint8_t first_byte;
+  memcpy(&first_byte, &byte_order_mark, 1);
+  return std::string("rrlib_serialization-") + cBINARY_FORMAT_VERSION + (first_byte ? "-le" : "-be");
+}
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+void tValueEncoding::Deserialize(const rrlib::xml::tNode& node, rrlib::rtti::tGenericObject& object)
+{
+  if (!node.HasAttribute(cATTRIBUTE))
+  {
+    object.Deserialize(node);
+    return;
+  }
+
+  std::string encoding = node.GetStringAttribute(cATTRIBUTE);
+  if (node.HasAttribute(cTYPE_ATTRIBUTE) && node.GetStringAttribute(cTYPE_ATTRIBUTE) != object.GetType().GetName())
+  {
+    throw std::runtime_error("Binary value has type '" + node.GetStringAttribute(cTYPE_ATTRIBUTE) + "' - expected '" + object.GetType().GetName() + "'");
+  }
+  if (encoding != cBINARY_BASE64)
+  {
+    throw std::runtime_error("Unknown value encoding '" + encoding + "'");
+  }
+  std::string format = node.HasAttribute(cFORMAT_ATTRIBUTE) ? node.GetStringAttribute(cFORMAT_ATTRIBUTE) : std::string();
+  if (format != GetBinaryFormat())
+  {
+    throw std::runtime_error("Binary value has format '" + format + "' - expected '" + GetBinaryFormat() + "'");
+  }
+  std::string data = DecodeBase64(node.GetTextContent());
+
+  rrlib::serialization::tMemoryBuffer buffer(&data[0], data.size());
+  rrlib::serialization::tInputStream stream(buffer);
+  object.Deserialize(stream);
+}
+#endif
+
+std::string tValueEncoding::EncodeBase64(const void* data, size_t size)
+{
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  std::string result;
+  result.reserve(((size + 2) / 3) * 4);
+  size_t i = 0;
+  for (; i + 2 < size; i += 3)
+  {
+    uint32_t bits = (static_cast<uint32_t>(bytes[i]) << 16) | (static_cast<uint32_t>(bytes[i + 1]) << 8) | bytes[i + 2];
+    result.push_back(cBASE64_CHARACTERS[(bits >> 18) & 0x3F]);
+    result.push_back(cBASE64_CHARACTERS[(bits >> 12) & 0x3F]);
+    result.push_back(cBASE64_CHARACTERS[(bits >> 6) & 0x3F]);
+    result.push_back(cBASE64_CHARACTERS[bits & 0x3F]);
+  }
+  if (i < size)
+  {
+    uint32_t bits = static_cast<uint32_t>(bytes[i]) << 16;
+    if (i + 1 < size)
+    {
+      bits |= static_cast<uint32_t>(bytes[i + 1]) << 8;
+    }
+    result.push_back(cBASE64_CHARACTERS[(bits >> 18) & 0x3F]);
+    result.push_back(cBASE64_CHARACTERS[(bits >> 12) & 0x3F]);
+    result.push_back(i + 1 < size ? cBASE64_CHARACTERS[(bits >> 6) & 0x3F] : '=');
+    result.push_back('=');
+  }
+  return result;
+}
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+/*!
+ * Removes all encoding-related attributes from element
+ *
+ * \param node Element
+ */
+static void RemoveAttributes(rrlib::xml::tNode& node)
+{
+  for (const char* attribute : { tValueEncoding::cATTRIBUTE, tValueEncoding::cFORMAT_ATTRIBUTE, cTYPE_ATTRIBUTE })
+  {
+    if (node.HasAttribute(attribute))
+    {
+      node.RemoveAttribute(attribute);
+    }
+  }
+}
+
+bool tValueEncoding::IsEncoded(const rrlib::xml::tNode& node)
+{
+  return node.HasAttribute(cATTRIBUTE);
+}
+
+void tValueEncoding::Serialize(rrlib::xml::tNode& node, const rrlib::rtti::tGenericObject& object, size_t binary_threshold)
+{
+  if (binary_threshold)
+  {
+    rrlib::serialization::tMemoryBuffer buffer;
+    rrlib::serialization::tOutputStream stream(buffer);
+    object.Serialize(stream);
+    stream.Close();
+    if (buffer.GetSize() >= binary_threshold)
+    {
+      while (node.ChildrenBegin() != node.ChildrenEnd())
+      {
+        node.RemoveChildNode(*node.ChildrenBegin());
+      }
+      RemoveAttributes(node);
+      node.SetAttribute(cATTRIBUTE, std::string(cBINARY_BASE64));
+      node.SetAttribute(cFORMAT_ATTRIBUTE, GetBinaryFormat());
+      node.SetAttribute(cTYPE_ATTRIBUTE, object.GetType().GetName());
+      node.SetContent(EncodeBase64(buffer.GetBufferPointer(), buffer.GetSize()));
+      return;
+    }
+  }
+
+  if (IsEncoded(node))
+  {
+    RemoveAttributes(node);
+    node.SetContent("");
+  }
+  object.Serialize(node);
+}
+#endif
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,159 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/internal/tValueEncoding.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tValueEncoding
+ *
+ * \b tValueEncoding
+ *
+ * Encodings of config entry values other than XML text.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__parameters__internal__tValueEncoding_h__
+#define __plugins__parameters__internal__tValueEncoding_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/rtti/rtti.h"
+#include <string>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Value encoding
+/*!
+ * Encodings of config entry values other than XML text.
+ *
+ * Large values (e.g. calibration matrices or lookup tables) can be stored in
+ * the binary form of rrlib_serialization - which is much cheaper to load than
+ * parsing thousands of numbers from text.
+ * The encoding is specified by the 'encoding' attribute of a 'value' element:
+ *
+ *   <value name="matrix" encoding="binary-base64" format="rrlib_serialization-1-le" type="...">...</value>
+ *
+ * The 'type' attribute contains the name of the serialized data type (binary data can only be loaded into objects of this type).
+ * As the binary form depends on byte order and on the version of rrlib_serialization, the 'format' attribute records both
+ * (see GetBinaryFormat()). Values in other formats are rejected - they must be converted by saving them as XML text.
+ */
+class tValueEncoding
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Name of attribute that contains encoding */
+  static const char* cATTRIBUTE;
+
+  /*! Binary data encoded in base64 */
+  static const char* cBINARY_BASE64;
+
+  /*! Name of attribute that contains format of binary data */
+  static const char* cFORMAT_ATTRIBUTE;
+
+  /*! Default size (in bytes) of binary data above which values are stored in binary form */
+  static const size_t cDEFAULT_BINARY_THRESHOLD = 4096;
+
+  /*!
+   * \param base64 Base64-encoded data (whitespace is ignored)
+   * \return Decoded data
+   *
+   * \throw Throws std::runtime_error if data is not valid base64 (incomplete or unpadded groups, misplaced padding, non-zero unused bits)
+   */
+  static std::string DecodeBase64(const std::string& base64);
+
+  /*!
+   * \param data Data to encode
+   * \param size Size of data
+   * \return Base64-encoded data
+   */
+  static std::string EncodeBase64(const void* data, size_t size);
+
+  /*!
+   * \return Format of binary data written by this process (version of binary format and byte order - e.g. 'rrlib_serialization-1-le')
+   */
+  static std::string GetBinaryFormat();
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  /*!
+   * Deserializes object from 'value' element - in any encoding
+   *
+   * \param node Element
+   * \param object Object to deserialize
+   *
+   * \throw Throws std::runtime_error if value cannot be deserialized
+   */
+  static void Deserialize(const rrlib::xml::tNode& node, rrlib::rtti::tGenericObject& object);
+
+  /*!
+   * \param node Element
+   * \return Is value of element stored in encoding other than XML text?
+   */
+  static bool IsEncoded(const rrlib::xml::tNode& node);
+
+  /*!
+   * Serializes object to 'value' element.
+   * Objects whose binary form has at least the specified size are stored base64-encoded - all others as XML text.
+   *
+   * \param node Element (any previous value is replaced)
+   * \param object Object to serialize
+   * \param binary_threshold Size of binary form (in bytes) from which objects are stored in binary form (0 disables binary form)
+   */
+  static void Serialize(rrlib::xml::tNode& node, const rrlib::rtti::tGenericObject& object, size_t binary_threshold);
+#endif
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
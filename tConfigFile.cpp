@@ -34,11 +34,39 @@
 //----------------------------------------------------------------------
 #include "rrlib/rtti/rtti.h"
 #include "core/file_lookup.h"
+#include "core/tRuntimeEnvironment.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <map>
+#include <random>
+#include <unordered_set>
+#include <thread>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "rrlib/thread/tLock.h"
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "plugins/parameters/internal/tParameterInfo.h"
+#include "plugins/parameters/internal/tCompiledConfig.h"
+#include "plugins/parameters/internal/tConfigSnapshot.h"
+#include "plugins/parameters/internal/tFlatConfig.h"
+#include "plugins/parameters/internal/tSharedConfigCache.h"
+#include "plugins/parameters/internal/tValueEncoding.h"
+#include "plugins/parameters/tConfigNode.h"
+#include "plugins/parameters/internal/tFileWatcher.h"
+#include "plugins/parameters/internal/tStaticParameterList.h"
+#include "plugins/parameters/internal/tStaticParameterImplementationBase.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -63,378 +91,2621 @@ namespace parameters
 #ifdef _LIB_RRLIB_XML_PRESENT_
 typedef rrlib::xml::tNode tXMLNode;
 
+/*! Top-level element in XML file (as determined by ScanXMLStructure()) */
+struct tTopLevelElement
+{
+  /*! Byte range of element in XML file */
+  size_t offset, length;
+
+  /*! Value of name attribute if element is a 'node' or 'value' element (empty otherwise) */
+  std::string name;
+};
+
+/*! Config files that are parsed in advance (see tConfigFile::Preload()) */
+struct tPreloadedDocuments
+{
+  /*! Mutex for preloaded documents */
+  rrlib::thread::tMutex mutex;
+
+  /*! File name => parsed document (future) */
+  std::map<std::string, std::future<std::unique_ptr<rrlib::xml::tDocument>>> documents;
+
+  /*! Worker threads (futures wait for threads to finish on destruction) */
+  std::vector<std::future<void>> workers;
+};
+
+/*!
+ * \return Config files that are parsed in advance
+ */
+static tPreloadedDocuments& PreloadedDocuments()
+{
+  static tPreloadedDocuments documents;
+  return documents;
+}
+#endif
+
+/*! Size of binary form (in bytes) from which SerializeEntry() stores values in binary form */
+static std::atomic<size_t> binary_value_threshold(internal::tValueEncoding::cDEFAULT_BINARY_THRESHOLD);
+
+/*! FNV-1a offset basis and prime (for fingerprints) */
+static const uint64_t cFNV_OFFSET_BASIS = 14695981039346656037ULL;
+static const uint64_t cFNV_PRIME = 1099511628211ULL;
+
+/*! Is shared config cache enabled? */
+static std::atomic<bool> shared_cache_enabled(false);
+
+/*!
+ * Acquires exclusive access for modifying config file:
+ * Structure mutex (if config file is attached to a framework element) - and then exclusive lock on config file.
+ * This order is mandatory, as readers holding the structure mutex may wait for a shared lock on the config file.
+ * Reentrant for the thread that already has exclusive access.
+ */
+class tConfigFile::tModificationLock : private rrlib::util::tNoncopyable
+{
+public:
+  explicit tModificationLock(tConfigFile& file) :
+    structure_lock(AcquireStructureLock(file)),
+    exclusive_lock(file.access_lock)
+  {
+    file.modification_count++;
+  }
+
+private:
+
+  /*! Lock on structure mutex (null if not required) */
+  std::unique_ptr<rrlib::thread::tLock> structure_lock;
+
+  /*! Exclusive lock on config file */
+  internal::tReadWriteLock::tExclusiveLock exclusive_lock;
+
+  static rrlib::thread::tLock* AcquireStructureLock(tConfigFile& file)
+  {
+    core::tFrameworkElement* element = file.GetAnnotated<core::tFrameworkElement>();
+    if (file.access_lock.IsExclusivelyOwned() || element == nullptr)
+    {
+      return nullptr;
+    }
+    return new rrlib::thread::tLock(element->GetStructureMutex());
+  }
+};
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+template <typename TResult, typename TFunction>
+TResult tConfigFile::ReadEntry(const internal::tConfigPath& entry, TFunction function)
+{
+  {
+    internal::tReadWriteLock::tSharedLock lock(access_lock);
+    bool parse_subtrees = backend || (entry.Size() && lazy_subtree_index.count(entry[0]));
+    if (!parse_subtrees)
+    {
+      return function(LookupEntry(entry));
+    }
+  }
+  if (parse_subtrees_forbidden)
+  {
+    throw tSubtreesNotParsed();
+  }
+  tModificationLock lock(*this);
+  MaterializeSubtrees(entry);
+  return function(LookupEntry(entry));
+}
+#endif
+
+/*! State shared between config file and file watcher callback */
+struct tConfigFile::tHotReloadState
+{
+  /*! Mutex for state (acquired after structure mutex) */
+  rrlib::thread::tMutex mutex;
+
+  /*! Config file to reload (null once hot reload is disabled) */
+  tConfigFile* config_file;
+
+  /*! Watched file */
+  std::string file;
+
+  /*! Status of watched file after it was last written by SaveFile() (modifications by SaveFile() do not trigger reloading) */
+  bool own_write_valid;
+  struct stat own_write;
+};
+
+/*! Values of parameters to load after config file was changed (see LoadChangedParameterValues()) */
+struct tConfigFile::tPendingLoads
+{
+  std::vector<internal::tParameterInfo::tPendingLoad> loads;
+};
+
 //----------------------------------------------------------------------
 // Const values
 //----------------------------------------------------------------------
-/*! Separator entries are divided with */
-static const std::string cSEPARATOR("/");
-
+#ifdef _LIB_RRLIB_XML_PRESENT_
 /*! Branch name in XML */
 static const std::string cXML_BRANCH_NAME("node");
 
 /*! Leaf name in XML */
 static const std::string cXML_LEAF_NAME("value");
+
+/*! Name of placeholder nodes for lazy subtrees in XML */
+static const std::string cXML_LAZY_PLACEHOLDER_NAME("lazy");
 #endif
 
 /*! Initializes annotation type so that it can be transferred to finstruct */
 static rrlib::rtti::tDataType<tConfigFile> cTYPE;
 
+/*! Generation of parameter bindings to config files (incremented whenever bindings may have changed) */
+static std::atomic<int> binding_generation(0);
+
+/*! Maximum number of entries in change log (older changes are discarded - requiring complete documents to be serialized) */
+static const size_t cMAX_CHANGE_LOG_SIZE = 4096;
+
+thread_local bool tConfigFile::parse_subtrees_forbidden = false;
+
 //----------------------------------------------------------------------
 // Implementation
 //----------------------------------------------------------------------
 
+/*!
+ * \return New (random, non-zero) lineage identifier
+ */
+static uint64_t CreateLineage()
+{
+  static rrlib::thread::tMutex mutex;
+  static std::mt19937_64 generator(std::random_device{}());
+  rrlib::thread::tLock lock(mutex);
+  uint64_t result = 0;
+  while (result == 0)
+  {
+    result = generator();
+  }
+  return result;
+}
+
+/*!
+ * \param a Status of file
+ * \param b Status of file
+ * \return True if both status refer to the same file with the same size and modification time
+ */
+static bool SameFileStatus(const struct stat& a, const struct stat& b)
+{
+  return a.st_dev == b.st_dev && a.st_ino == b.st_ino && a.st_size == b.st_size &&
+         a.st_mtim.tv_sec == b.st_mtim.tv_sec && a.st_mtim.tv_nsec == b.st_mtim.tv_nsec;
+}
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+/*!
+ * Decodes XML attribute value
+ *
+ * \param text Attribute value as contained in XML file
+ * \param result Decoded attribute value
+ * \return True if value could be decoded (only predefined entities are supported)
+ */
+static bool DecodeXMLAttributeValue(const std::string& text, std::string& result)
+{
+  result.clear();
+  for (size_t i = 0; i < text.length(); i++)
+  {
+    if (text[i] != '&')
+    {
+      result += text[i];
+      continue;
+    }
+    size_t end = text.find(';', i);
+    if (end == std::string::npos)
+    {
+      return false;
+    }
+    std::string entity = text.substr(i + 1, end - i - 1);
+    if (entity == "amp")
+    {
+      result += '&';
+    }
+    else if (entity == "lt")
+    {
+      result += '<';
+    }
+    else if (entity == "gt")
+    {
+      result += '>';
+    }
+    else if (entity == "quot")
+    {
+      result += '"';
+    }
+    else if (entity == "apos")
+    {
+      result += '\'';
+    }
+    else
+    {
+      return false;
+    }
+    i = end;
+  }
+  return true;
+}
+
+/*!
+ * \param xml XML file content
+ * \param position Position of '<' character that starts markup (tag, comment, processing instruction, CDATA section, or declaration)
+ * \return Position after end of markup - or std::string::npos if markup is not terminated
+ */
+static size_t FindMarkupEnd(const std::string& xml, size_t position)
+{
+  const char* terminator = nullptr;
+  if (xml.compare(position, 4, "<!--") == 0)
+  {
+    terminator = "-->";
+  }
+  else if (xml.compare(position, 9, "<![CDATA[") == 0)
+  {
+    terminator = "]]>";
+  }
+  else if (xml.compare(position, 2, "<?") == 0)
+  {
+    terminator = "?>";
+  }
+  if (terminator)
+  {
+    size_t end = xml.find(terminator, position);
+    return end == std::string::npos ? end : (end + strlen(terminator));
+  }
+
+  char quote = 0;
+  for (size_t i = position + 1; i < xml.length(); i++)
+  {
+    char c = xml[i];
+    if (quote)
+    {
+      quote = (c == quote) ? 0 : quote;
+    }
+    else if (c == '"' || c == '\'')
+    {
+      quote = c;
+    }
+    else if (c == '>')
+    {
+      return i + 1;
+    }
+  }
+  return std::string::npos;
+}
+
+/*!
+ * \param start_tag Start tag of element
+ * \param name Contains value of name attribute after call if element is a 'node' or 'value' element (empty otherwise)
+ * \return False if start tag could not be processed
+ */
+static bool GetConfigEntryName(const std::string& start_tag, std::string& name)
+{
+  name.clear();
+  size_t i = 1;
+  while (i < start_tag.length() && (!isspace(start_tag[i])) && start_tag[i] != '>' && start_tag[i] != '/')
+  {
+    i++;
+  }
+  std::string element_name = start_tag.substr(1, i - 1);
+  if (element_name != cXML_BRANCH_NAME && element_name != cXML_LEAF_NAME)
+  {
+    return true;
+  }
+
+  while (true)
+  {
+    while (i < start_tag.length() && isspace(start_tag[i]))
+    {
+      i++;
+    }
+    if (i >= start_tag.length() || start_tag[i] == '>' || start_tag[i] == '/')
+    {
+      return true; // no name attribute
+    }
+    size_t attribute_start = i;
+    while (i < start_tag.length() && start_tag[i] != '=' && (!isspace(start_tag[i])))
+    {
+      i++;
+    }
+    std::string attribute = start_tag.substr(attribute_start, i - attribute_start);
+    while (i < start_tag.length() && (start_tag[i] == '=' || isspace(start_tag[i])))
+    {
+      i++;
+    }
+    if (i >= start_tag.length() || (start_tag[i] != '"' && start_tag[i] != '\''))
+    {
+      return false;
+    }
+    size_t value_end = start_tag.find(start_tag[i], i + 1);
+    if (value_end == std::string::npos)
+    {
+      return false;
+    }
+    if (attribute == "name")
+    {
+      return DecodeXMLAttributeValue(start_tag.substr(i + 1, value_end - i - 1), name);
+    }
+    i = value_end + 1;
+  }
+}
+
+/*!
+ * Collects all leaf entries below node (in document order)
+ *
+ * \param node Node whose leaf entries to collect
+ * \param entry Path of node (empty for root node). Temporarily extended during call.
+ * \param result Path and node of each leaf entry are appended to this vector
+ */
+static void CollectLeafEntries(rrlib::xml::tNode& node, internal::tConfigPath& entry, std::vector<std::pair<internal::tConfigPath, rrlib::xml::tNode*>>& result)
+{
+  for (rrlib::xml::tNode::iterator child = node.ChildrenBegin(); child != node.ChildrenEnd(); ++child)
+  {
+    if ((child->Name() == cXML_BRANCH_NAME || child->Name() == cXML_LEAF_NAME) && child->HasAttribute("name"))
+    {
+      size_t parent_size = entry.Size();
+      entry.Append(child->GetStringAttribute("name"));
+      if (child->Name() == cXML_LEAF_NAME)
+      {
+        result.emplace_back(entry, &(*child));
+      }
+      else
+      {
+        CollectLeafEntries(*child, entry, result);
+      }
+      while (entry.Size() > parent_size)
+      {
+        entry.RemoveLast();
+      }
+    }
+  }
+}
+
+/*!
+ * \param root_node Root node of document
+ * \return Content of XML file with specified document (as written by rrlib::xml::tDocument::WriteToFile())
+ */
+static std::string GetXMLFileContent(const rrlib::xml::tNode& root_node)
+{
+  return "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n" + root_node.GetXMLDump(true) + "\n";
+}
+
+/*!
+ * Removes all leaf entries below node whose XML equals the specified XML - as well as branches that become empty
+ *
+ * \param node Node whose leaf entries to remove
+ * \param entry Path of node (empty for root node). Temporarily extended during call.
+ * \param remove Path => XML of leaf entries to remove
+ */
+static void RemoveLeafEntries(rrlib::xml::tNode& node, internal::tConfigPath& entry, const std::unordered_map<internal::tConfigPath, std::string>& remove)
+{
+  std::vector<rrlib::xml::tNode*> children;
+  for (rrlib::xml::tNode::iterator child = node.ChildrenBegin(); child != node.ChildrenEnd(); ++child)
+  {
+    children.push_back(&(*child));
+  }
+  for (rrlib::xml::tNode* child : children)
+  {
+    if ((child->Name() == cXML_BRANCH_NAME || child->Name() == cXML_LEAF_NAME) && child->HasAttribute("name"))
+    {
+      size_t parent_size = entry.Size();
+      entry.Append(child->GetStringAttribute("name"));
+      if (child->Name() == cXML_LEAF_NAME)
+      {
+        auto it = remove.find(entry);
+        if (it != remove.end() && it->second == child->GetXMLDump())
+        {
+          node.RemoveChildNode(*child);
+        }
+      }
+      else
+      {
+        RemoveLeafEntries(*child, entry, remove);
+        if (child->ChildrenBegin() == child->ChildrenEnd())
+        {
+          node.RemoveChildNode(*child);
+        }
+      }
+      while (entry.Size() > parent_size)
+      {
+        entry.RemoveLast();
+      }
+    }
+  }
+}
+
+/*!
+ * Fast structural pre-scan of XML file.
+ * Determines byte ranges of all child elements of the root element - without parsing them.
+ *
+ * \param xml XML file content
+ * \param root_start_tag Contains start tag of root element after call
+ * \param elements Contains child elements of root element after call
+ * \return True if XML file can be loaded lazily (false e.g. if it is malformed or uses DTD entities or namespaces)
+ */
+static bool ScanXMLStructure(const std::string& xml, std::string& root_start_tag, std::vector<tTopLevelElement>& elements)
+{
+  // Skip prolog
+  size_t position = 0;
+  while (true)
+  {
+    position = xml.find('<', position);
+    if (position == std::string::npos || position + 1 >= xml.length())
+    {
+      return false;
+    }
+    if (xml[position + 1] != '!' && xml[position + 1] != '?')
+    {
+      break;
+    }
+    size_t end = FindMarkupEnd(xml, position);
+    if (end == std::string::npos)
+    {
+      return false;
+    }
+    std::string markup = xml.substr(position, end - position);
+    if (markup.compare(0, 9, "<!DOCTYPE") == 0 && markup.find('[') != std::string::npos)
+    {
+      return false; // internal DTD subset may declare entities
+    }
+    if (markup.compare(0, 5, "<?xml") == 0 && markup.find("encoding") != std::string::npos && markup.find("UTF-8") == std::string::npos && markup.find("utf-8") == std::string::npos)
+    {
+      return false; // subtrees are parsed as UTF-8
+    }
+    position = end;
+  }
+
+  // Root element
+  size_t end = FindMarkupEnd(xml, position);
+  if (end == std::string::npos)
+  {
+    return false;
+  }
+  root_start_tag = xml.substr(position, end - position);
+  if (root_start_tag.find("xmlns") != std::string::npos)
+  {
+    return false;
+  }
+  if (xml[end - 2] == '/')
+  {
+    return true; // root element has no children
+  }
+  position = end;
+
+  // Child elements of root element
+  while (true)
+  {
+    position = xml.find('<', position);
+    if (position == std::string::npos || position + 1 >= xml.length())
+    {
+      return false;
+    }
+    if (xml[position + 1] == '/')
+    {
+      return true; // end tag of root element
+    }
+    end = FindMarkupEnd(xml, position);
+    if (end == std::string::npos)
+    {
+      return false;
+    }
+    if (xml[position + 1] == '!' || xml[position + 1] == '?')
+    {
+      position = end;
+      continue;
+    }
+
+    tTopLevelElement element;
+    element.offset = position;
+    if (!GetConfigEntryName(xml.substr(position, end - position), element.name))
+    {
+      return false;
+    }
+    size_t depth = (xml[end - 2] == '/') ? 0 : 1;
+    while (depth > 0)
+    {
+      size_t markup_start = xml.find('<', end);
+      if (markup_start == std::string::npos || markup_start + 1 >= xml.length())
+      {
+        return false;
+      }
+      end = FindMarkupEnd(xml, markup_start);
+      if (end == std::string::npos)
+      {
+        return false;
+      }
+      if (xml[markup_start + 1] == '/')
+      {
+        depth--;
+      }
+      else if (xml[markup_start + 1] != '!' && xml[markup_start + 1] != '?' && xml[end - 2] != '/')
+      {
+        depth++;
+      }
+    }
+    element.length = end - element.offset;
+    elements.push_back(element);
+    position = end;
+  }
+}
+/*!
+ * Reconstructs XML document from entries of backend (compiled or flat config file)
+ *
+ * \param source Backend
+ * \param document Document to add entries to (must have root node)
+ */
+static void ReconstructDocument(const internal::tConfigBackend& source, rrlib::xml::tDocument& document)
+{
+  std::unordered_map<internal::tConfigPath, rrlib::xml::tNode*> branches;
+  std::function<rrlib::xml::tNode&(const internal::tConfigPath&)> get_branch = [&](const internal::tConfigPath & entry) -> rrlib::xml::tNode&
+  {
+    if (entry.Empty())
+    {
+      return document.RootNode();
+    }
+    auto it = branches.find(entry);
+    if (it != branches.end())
+    {
+      return *it->second;
+    }
+    internal::tConfigPath parent_entry = entry;
+    parent_entry.RemoveLast();
+    rrlib::xml::tNode& created = get_branch(parent_entry).AddChildNode(cXML_BRANCH_NAME);
+    created.SetAttribute("name", *entry[entry.Size() - 1]);
+    branches.emplace(entry, &created);
+    return created;
+  };
+
+  for (size_t i = 0; i < source.Size(); i++)
+  {
+    internal::tConfigPath entry(source.GetName(i));
+    internal::tConfigBackend::tValue value = source.GetValue(i);
+    try
+    {
+      if (entry.Empty())
+      {
+        throw std::runtime_error("Cannot create config entry without name");
+      }
+      internal::tConfigPath parent_entry = entry;
+      parent_entry.RemoveLast();
+      rrlib::xml::tNode& parent = get_branch(parent_entry);
+      if (value.xml_fragment)
+      {
+        std::string xml = value.ToString();
+        rrlib::xml::tDocument fragment(xml.c_str(), xml.length() + 1);
+        parent.AddChildNode(fragment.RootNode(), true);
+      }
+      else
+      {
+        rrlib::xml::tNode& created = parent.AddChildNode(cXML_LEAF_NAME);
+        created.SetAttribute("name", *entry[entry.Size() - 1]);
+        created.SetContent(value.ToString());
+      }
+    }
+    catch (const std::exception& e)
+    {
+      FINROC_LOG_PRINT_STATIC(ERROR, "Could not restore config entry '", entry.ToString(), "' from ", (source.GetKind() == internal::tConfigBackend::tKind::FLAT ? "flat" : "compiled"), " config file: ", e);
+    }
+  }
+}
+#endif
+
 tConfigFile::tConfigFile() :
 #ifdef _LIB_RRLIB_XML_PRESENT_
   wrapped(),
 #endif
   filename(),
-  active(true)
+  active(true),
+  backend(),
+  lineage(CreateLineage()),
+  own_lineage(lineage),
+  revision(0),
+  change_log(),
+  change_log_start(0),
+  synced_revision(0, 0),
+  synced_revision_mutex(),
+  hot_reload_state(),
+  hot_reload_watch(0),
+  published_snapshot(),
+  access_lock(),
+  modification_count(0),
+  first_registered_parameter(nullptr),
+  first_registered_static_parameter_list(nullptr),
+  registry_generation(-1)
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  , entry_index(),
+  duplicate_entries(),
+  reported_duplicate_entries(),
+  unnamed_entries(),
+  lazy_xml(),
+  lazy_subtrees(),
+  lazy_subtree_index(),
+  layers(),
+  layer_base()
+#endif
 {
+  InvalidateParameterRegistries();
 #ifdef _LIB_RRLIB_XML_PRESENT_
   wrapped.AddRootNode(cXML_BRANCH_NAME);
 #endif
 }
 
-tConfigFile::tConfigFile(const std::string& filename, bool optional) :
+tConfigFile::tConfigFile(const std::string& filename, bool optional, bool lazy) :
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  wrapped(),
+#endif
+  filename(filename),
+  active(true),
+  backend(),
+  lineage(CreateLineage()),
+  own_lineage(lineage),
+  revision(0),
+  change_log(),
+  change_log_start(0),
+  synced_revision(0, 0),
+  synced_revision_mutex(),
+  hot_reload_state(),
+  hot_reload_watch(0),
+  published_snapshot(),
+  access_lock(),
+  modification_count(0),
+  first_registered_parameter(nullptr),
+  first_registered_static_parameter_list(nullptr),
+  registry_generation(-1)
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  , entry_index(),
+  duplicate_entries(),
+  reported_duplicate_entries(),
+  unnamed_entries(),
+  lazy_xml(),
+  lazy_subtrees(),
+  lazy_subtree_index(),
+  layers(),
+  layer_base()
+#endif
+{
+  InvalidateParameterRegistries();
+
+  // flat config file?
+  if (internal::tFlatConfig::IsFlatFile(filename))
+  {
+    try
+    {
+      if (core::FinrocFileExists(filename))
+      {
+        backend.reset(new internal::tFlatConfig(core::GetFinrocFile(filename)));
+        return;
+      }
+      if (!optional)
+      {
+        FINROC_LOG_PRINT(WARNING, "Specified config file not found: ", filename);
+      }
+    }
+    catch (const std::exception& e)
+    {
+      FINROC_LOG_PRINT(ERROR, e);
+    }
+    backend.reset(new internal::tFlatConfig());
+    return;
+  }
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  // has config file been preloaded?
+  std::unique_ptr<rrlib::xml::tDocument> preloaded_document;
+  {
+    tPreloadedDocuments& preloaded = PreloadedDocuments();
+    std::future<std::unique_ptr<rrlib::xml::tDocument>> future;
+    {
+      rrlib::thread::tLock lock(preloaded.mutex);
+      auto it = preloaded.documents.find(filename);
+      if (it != preloaded.documents.end())
+      {
+        future = std::move(it->second);
+        preloaded.documents.erase(it);
+      }
+    }
+    if (future.valid())
+    {
+      try
+      {
+        preloaded_document = future.get();
+      }
+      catch (const std::exception& e)
+      {
+        FINROC_LOG_PRINT(ERROR, e);
+      }
+    }
+  }
+#endif
+
+  // use compiled config file if there is an up-to-date one
+  std::string compiled_filename = filename + internal::tCompiledConfig::cFILE_EXTENSION;
+  if (core::FinrocFileExists(compiled_filename))
+  {
+    std::string compiled_file = core::GetFinrocFile(compiled_filename);
+    if ((!core::FinrocFileExists(filename)) || internal::tCompiledConfig::IsUpToDate(compiled_file, core::GetFinrocFile(filename)))
+    {
+      try
+      {
+        backend.reset(new internal::tCompiledConfig(compiled_file));
+        return;
+      }
+      catch (const std::exception& e)
+      {
+        FINROC_LOG_PRINT(WARNING, e);
+      }
+    }
+    else
+    {
+      FINROC_LOG_PRINT(WARNING, "Compiled config file '", compiled_file, "' is outdated. Loading XML file.");
+    }
+  }
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  if (core::FinrocFileExists(filename))
+  {
+    try
+    {
+      if (preloaded_document)
+      {
+        wrapped = std::move(*preloaded_document);
+        RebuildEntryIndex();
+        return;
+      }
+      if (shared_cache_enabled)
+      {
+        std::string cache_file = internal::tSharedConfigCache::GetCacheFile(core::GetFinrocFile(filename));
+        try
+        {
+          backend = internal::tSharedConfigCache::Attach(cache_file);
+          if (backend)
+          {
+            return;
+          }
+        }
+        catch (const std::exception& e)
+        {
+          FINROC_LOG_PRINT(WARNING, "Could not attach to shared config cache: ", e);
+        }
+        wrapped = core::GetFinrocXMLDocument(filename, false); // false = do not validate with dtd
+        RebuildEntryIndex();
+        if (cache_file.length())
+        {
+          try
+          {
+            std::vector<internal::tConfigBackend::tEntry> entries;
+            GetLeafEntries(entries);
+            internal::tSharedConfigCache::Publish(cache_file, entries);
+          }
+          catch (const std::exception& e)
+          {
+            FINROC_LOG_PRINT(WARNING, "Could not publish shared config cache: ", e);
+          }
+        }
+        return;
+      }
+      if (lazy && LoadLazily(core::GetFinrocFile(filename)))
+      {
+        return;
+      }
+      wrapped = core::GetFinrocXMLDocument(filename, false); // false = do not validate with dtd
+      RebuildEntryIndex();
+      return;
+    }
+    catch (const std::exception& e)
+    {
+      FINROC_LOG_PRINT(ERROR, e);
+    }
+  }
+  else if (!optional)
+  {
+    FINROC_LOG_PRINT(WARNING, "Specified config file not found: ", filename);
+  }
+  wrapped = rrlib::xml::tDocument();
+  wrapped.AddRootNode(cXML_BRANCH_NAME);
+#else
+  if (core::FinrocFileExists(filename))
+  {
+    FINROC_LOG_PRINT(ERROR, "Loading XML config file '", filename, "' requires XML support. Please use a flat or compiled config file.");
+  }
+  else if (!optional)
+  {
+    FINROC_LOG_PRINT(WARNING, "Specified config file not found: ", filename);
+  }
+#endif
+}
+
+tConfigFile::tConfigFile(const std::vector<std::string>& layers, bool optional) :
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  wrapped(),
+#endif
+  filename(layers.size() ? layers.back() : std::string()),
+  active(true),
+  backend(),
+  lineage(CreateLineage()),
+  own_lineage(lineage),
+  revision(0),
+  change_log(),
+  change_log_start(0),
+  synced_revision(0, 0),
+  synced_revision_mutex(),
+  hot_reload_state(),
+  hot_reload_watch(0),
+  published_snapshot(),
+  access_lock(),
+  modification_count(0),
+  first_registered_parameter(nullptr),
+  first_registered_static_parameter_list(nullptr),
+  registry_generation(-1)
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  , entry_index(),
+  duplicate_entries(),
+  reported_duplicate_entries(),
+  unnamed_entries(),
+  lazy_xml(),
+  lazy_subtrees(),
+  lazy_subtree_index(),
+  layers(layers),
+  layer_base()
+#endif
+{
+  if (layers.empty())
+  {
+    throw std::runtime_error("Layered config file requires at least one layer");
+  }
+  InvalidateParameterRegistries();
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  LoadLayers(optional);
+#else
+  FINROC_LOG_PRINT(ERROR, "Layered config files require XML support. Only loading top layer '", filename, "'.");
+  if (internal::tFlatConfig::IsFlatFile(filename))
+  {
+    try
+    {
+      backend.reset(core::FinrocFileExists(filename) ? new internal::tFlatConfig(core::GetFinrocFile(filename)) : new internal::tFlatConfig());
+    }
+    catch (const std::exception& e)
+    {
+      FINROC_LOG_PRINT(ERROR, e);
+      backend.reset(new internal::tFlatConfig());
+    }
+  }
+#endif
+}
+
+tConfigFile::~tConfigFile()
+{
+  DisableHotReload();
+  while (first_registered_parameter)
+  {
+    UnregisterParameter(*first_registered_parameter);
+  }
+  while (first_registered_static_parameter_list)
+  {
+    UnregisterStaticParameters(*first_registered_static_parameter_list);
+  }
+  InvalidateParameterRegistries();  // parameters are configured from other config files now
+}
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+void tConfigFile::AddToEntryIndex(rrlib::xml::tNode& node, internal::tConfigPath& entry)
+{
+  if (node.Name() == cXML_BRANCH_NAME || node.Name() == cXML_LEAF_NAME)
+  {
+    if (!node.HasAttribute("name"))
+    {
+      FINROC_LOG_PRINT(WARNING, "Encountered tree node without name");
+      unnamed_entries.push_back(entry);
+      return;
+    }
+    size_t parent_size = entry.Size();
+    entry.Append(node.GetStringAttribute("name"));
+    auto it = entry_index.find(entry);
+    if (it == entry_index.end())
+    {
+      entry_index.emplace(entry, tIndexEntry { &node, 1 });
+    }
+    else
+    {
+      it->second.count++;
+      if (it->second.count == 2)
+      {
+        duplicate_entries.push_back(entry);
+        if (reported_duplicate_entries.insert(entry).second)
+        {
+          FINROC_LOG_PRINT(WARNING, "There are multiple entries in config file '", filename, "' with the qualified name '", entry.ToString(), "'. Using the first one.");
+        }
+      }
+    }
+    for (rrlib::xml::tNode::iterator child = node.ChildrenBegin(); child != node.ChildrenEnd(); ++child)
+    {
+      AddToEntryIndex(*child, entry);
+    }
+    while (entry.Size() > parent_size)
+    {
+      entry.RemoveLast();
+    }
+  }
+}
+
+void tConfigFile::ApplyChange(const internal::tConfigPath& entry, const std::string* xml)
+{
+  if (xml == nullptr)
+  {
+    ApplyChange(entry, static_cast<rrlib::xml::tNode*>(nullptr));
+    return;
+  }
+  rrlib::xml::tDocument fragment(xml->c_str(), xml->length() + 1);
+  ApplyChange(entry, &fragment.RootNode());
+}
+
+void tConfigFile::ApplyChange(const internal::tConfigPath& entry, rrlib::xml::tNode* node)
+{
+  MaterializeSubtrees(entry);
+  auto it = entry_index.find(entry);
+  if (node == nullptr)
+  {
+    if (it != entry_index.end())
+    {
+      it->second.node->Parent().RemoveChildNode(*it->second.node);
+      RebuildEntryIndex();
+    }
+    return;
+  }
+
+  if (it != entry_index.end())
+  {
+    // replace existing node (at same position)
+    tXMLNode& old_node = *it->second.node;
+    bool rebuild_index = it->second.count > 1 || old_node.ChildrenBegin() != old_node.ChildrenEnd(); // removing node affects other index entries
+    tXMLNode& new_node = old_node.AddNextSibling(*node, true);
+    new_node.SetAttribute("name", old_node.GetStringAttribute("name"));
+    old_node.Parent().RemoveChildNode(old_node);
+    if (rebuild_index)
+    {
+      RebuildEntryIndex();
+    }
+    else
+    {
+      it->second.node = &new_node;
+    }
+  }
+  else
+  {
+    internal::tConfigPath parent_entry = entry;
+    parent_entry.RemoveLast();
+    tXMLNode& parent = parent_entry.Empty() ? wrapped.RootNode() : CreateEntry(parent_entry, false);
+    tXMLNode& new_node = parent.AddChildNode(*node, true);
+    new_node.SetAttribute("name", *entry[entry.Size() - 1]);
+    entry_index[entry] = tIndexEntry { &new_node, 1 };
+  }
+}
+
+void tConfigFile::ClearLazySubtrees()
+{
+  lazy_subtrees.clear();
+  lazy_subtree_index.clear();
+  lazy_xml.clear();
+  lazy_xml.shrink_to_fit();
+}
+
+rrlib::xml::tNode& tConfigFile::CreateEntry(const internal::tConfigPath& entry, bool leaf)
+{
+  if (entry.Empty())
+  {
+    throw std::runtime_error("Cannot create config entry without name");
+  }
+  if (!leaf)
+  {
+    auto it = entry_index.find(entry);
+    if (it != entry_index.end())
+    {
+      // do we want to warn if node is a leaf node? - I currently do not think so
+      return *it->second.node;
+    }
+  }
+
+  internal::tConfigPath parent_entry = entry;
+  parent_entry.RemoveLast();
+  tXMLNode& parent = parent_entry.Empty() ? wrapped.RootNode() : CreateEntry(parent_entry, false);
+  tXMLNode& created = parent.AddChildNode(leaf ? cXML_LEAF_NAME : cXML_BRANCH_NAME);
+  created.SetAttribute("name", *entry[entry.Size() - 1]);
+  entry_index[entry] = tIndexEntry { &created, 1 };
+  return created;
+}
+#endif
+
+bool tConfigFile::DeserializeEntry(const internal::tConfigPath& entry, rrlib::rtti::tGenericObject& object)
+{
+  {
+    internal::tReadWriteLock::tSharedLock lock(access_lock);
+    if (backend)
+    {
+      return backend->DeserializeEntry(entry, object);
+    }
+  }
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  return ReadEntry<bool>(entry, [&object](rrlib::xml::tNode * node)
+  {
+    if (node)
+    {
+      internal::tValueEncoding::Deserialize(*node, object);
+    }
+    return node != nullptr;
+  });
+#else
+  return false;
+#endif
+}
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+bool tConfigFile::DeserializeChanges(rrlib::serialization::tInputStream& stream)
+{
+  tModificationLock lock(*this);
+  uint64_t sender_lineage = static_cast<uint64_t>(stream.ReadLong());
+  uint64_t sender_revision = static_cast<uint64_t>(stream.ReadLong());
+  bool delta = stream.ReadBoolean();
+  if (!delta)
+  {
+    std::string content = stream.ReadString();
+    try
+    {
+      ReplaceDocument(rrlib::xml::tDocument(content.c_str(), content.length() + 1), sender_lineage, sender_revision);
+    }
+    catch (const std::exception& e)
+    {
+      FINROC_LOG_PRINT(ERROR, e);
+      return false;
+    }
+    if (std::atomic_load(&published_snapshot))
+    {
+      PublishSnapshot();
+    }
+    return true;
+  }
+
+  if (DeserializeDelta(stream, sender_lineage, sender_revision, true))
+  {
+    if (std::atomic_load(&published_snapshot))
+    {
+      PublishSnapshot();
+    }
+    return true;
+  }
+  return false;
+}
+
+bool tConfigFile::DeserializeDelta(rrlib::serialization::tInputStream& stream, uint64_t sender_lineage, uint64_t sender_revision, bool apply)
+{
+  uint64_t base_revision = static_cast<uint64_t>(stream.ReadLong());
+  int count = stream.ReadInt();
+  bool based_on_revision = sender_lineage == lineage && base_revision == revision;
+  if (apply && (!based_on_revision))
+  {
+    FINROC_LOG_PRINT(DEBUG, "Received changes of config file '", filename, "' that are based on a different revision. Ignoring them.");
+  }
+  apply = apply && based_on_revision;
+  for (int i = 0; i < count; i++)
+  {
+    bool exists = stream.ReadBoolean();
+    internal::tConfigPath entry(stream.ReadString());
+    std::string xml = exists ? stream.ReadString() : std::string();
+    if (apply)
+    {
+      try
+      {
+        ApplyChange(entry, exists ? &xml : nullptr);
+      }
+      catch (const std::exception& e)
+      {
+        FINROC_LOG_PRINT(ERROR, "Could not apply change of config entry '", entry.ToString(), "': ", e);
+      }
+      change_log.emplace_back(sender_revision, entry);
+    }
+  }
+  if (!apply)
+  {
+    return false;
+  }
+  while (change_log.size() > cMAX_CHANGE_LOG_SIZE)
+  {
+    change_log_start = change_log.front().first;
+    change_log.pop_front();
+  }
+  revision = sender_revision;
+  MarkParameterValuesChanged();
+  return true;
+}
+#endif
+
+bool tConfigFile::DeserializeEntry(const std::string& entry, rrlib::rtti::tGenericObject& object)
+{
+  return DeserializeEntry(internal::tConfigPath(entry), object);
+}
+
+void tConfigFile::DisableHotReload()
+{
+  if (hot_reload_state)
+  {
+    internal::tFileWatcher::GetInstance().RemoveWatch(hot_reload_watch);
+    rrlib::thread::tLock lock(hot_reload_state->mutex);  // waits for any reload in progress
+    hot_reload_state->config_file = nullptr;
+  }
+  hot_reload_state.reset();
+}
+
+void tConfigFile::EnableHotReload(std::chrono::milliseconds debounce)
+{
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  DisableHotReload();
+  if (!core::FinrocFileExists(filename))
+  {
+    FINROC_LOG_PRINT(WARNING, "Cannot watch config file '", filename, "' as it does not exist.");
+    return;
+  }
+  std::shared_ptr<tHotReloadState> state(new tHotReloadState());
+  state->config_file = this;
+  state->file = core::GetFinrocFile(filename);
+  state->own_write_valid = false;
+  try
+  {
+    hot_reload_watch = internal::tFileWatcher::GetInstance().AddWatch(state->file, debounce, [state]()
+    {
+      tPendingLoads pending_loads;
+      {
+        rrlib::thread::tLock lock1(core::tRuntimeEnvironment::GetInstance().GetStructureMutex());
+        rrlib::thread::tLock lock2(state->mutex);
+        struct stat file_info;
+        if (state->own_write_valid && stat(state->file.c_str(), &file_info) == 0 && SameFileStatus(file_info, state->own_write))
+        {
+          return;  // file was written by this config file
+        }
+        state->own_write_valid = false;
+        if (state->config_file)
+        {
+          state->config_file->ReloadFile(pending_loads);
+        }
+      }
+
+      // deserialize and publish values without holding any locks (ports and config files are deleted deferred)
+      internal::tParameterInfo::LoadValues(pending_loads.loads);
+    });
+    hot_reload_state = state;
+  }
+  catch (const std::exception& e)
+  {
+    FINROC_LOG_PRINT(ERROR, "Cannot watch config file '", filename, "': ", e);
+  }
+#else
+  FINROC_LOG_PRINT(WARNING, "Hot reload of config files requires XML support");
+#endif
+}
+
+void tConfigFile::EntryChanged(const internal::tConfigPath& entry)
+{
+  if (lineage != own_lineage)
+  {
+    // document is modified locally - so it continues with a new history
+    lineage = own_lineage;
+    change_log.clear();
+    change_log_start = revision;
+  }
+  revision++;
+  change_log.emplace_back(revision, entry);
+  if (change_log.size() > cMAX_CHANGE_LOG_SIZE)
+  {
+    change_log_start = change_log.front().first;
+    change_log.pop_front();
+  }
+}
+
+tConfigFile* tConfigFile::Find(const core::tFrameworkElement& element)
+{
+  tConfigFile* config_file = element.GetAnnotation<tConfigFile>();
+  if (config_file && config_file->active == true)
+  {
+    return config_file;
+  }
+  core::tFrameworkElement* parent = element.GetParent();
+  if (parent)
+  {
+    return Find(*parent);
+  }
+  return NULL;
+}
+
+void tConfigFile::ForceFullSerialization()
+{
+  tModificationLock lock(*this);
+  StartHistory(lineage, revision + 1);
+}
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+const rrlib::xml::tNode& tConfigFile::FindEntry(const std::string& path_to_entry)
+{
+  tModificationLock lock(*this);
+  MaterializeDocument();
+  return wrapped.FindNode(path_to_entry);
+}
+
+rrlib::xml::tNode& tConfigFile::GetEntry(const internal::tConfigPath& entry, bool create)
+{
+  tModificationLock lock(*this);
+  MaterializeSubtrees(entry);
+  auto it = entry_index.find(entry);
+  if (!create)
+  {
+    if (it == entry_index.end())
+    {
+      throw std::runtime_error("Config node not found: " + entry.ToString());
+    }
+    if (it->second.node->Name() != cXML_LEAF_NAME)
+    {
+      throw std::runtime_error("Config node is no leaf: " + entry.ToString());
+    }
+    return *it->second.node;
+  }
+
+  // create node...
+  if (it != entry_index.end())
+  {
+    // recreate existing node
+    tXMLNode& old_node = *it->second.node;
+    bool rebuild_index = it->second.count > 1 || old_node.ChildrenBegin() != old_node.ChildrenEnd(); // removing node affects other index entries
+    std::string name = old_node.GetStringAttribute("name");
+    tXMLNode& parent = old_node.Parent();
+    parent.RemoveChildNode(old_node);
+    tXMLNode& new_node = parent.AddChildNode(cXML_LEAF_NAME);
+    new_node.SetAttribute("name", name);
+    if (rebuild_index)
+    {
+      RebuildEntryIndex();
+    }
+    else
+    {
+      it->second.node = &new_node;
+    }
+    EntryChanged(entry);
+    return new_node;
+  }
+  else
+  {
+    tXMLNode& created = CreateEntry(entry, true);
+    EntryChanged(entry);
+    return created;
+  }
+}
+
+rrlib::xml::tNode& tConfigFile::GetEntry(const std::string& entry, bool create)
+{
+  return GetEntry(internal::tConfigPath(entry), create);
+}
+#endif
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+/*!
+ * \param source Backend
+ * \param entries Contains all entries of backend after call (in the same representation as tConfigFile::GetLeafEntries())
+ */
+static void GetBackendEntries(const internal::tConfigBackend& source, std::vector<internal::tConfigBackend::tEntry>& entries)
+{
+  entries.clear();
+  entries.reserve(source.Size());
+  for (size_t i = 0; i < source.Size(); i++)
+  {
+    internal::tConfigBackend::tValue value = source.GetValue(i);
+    entries.push_back(internal::tConfigBackend::tEntry { source.GetName(i), value.ToString(), value.xml_fragment });
+  }
+}
+
+void tConfigFile::GetLeafEntries(std::vector<internal::tConfigBackend::tEntry>& entries, const std::unordered_map<internal::tConfigPath, std::string>* exclude)
+{
+  MaterializeDocument();
+  entries.clear();
+  entries.reserve(entry_index.size());
+  for (auto it = entry_index.begin(); it != entry_index.end(); ++it)
+  {
+    tXMLNode& node = *it->second.node;
+    if (node.Name() == cXML_LEAF_NAME)
+    {
+      if (exclude)
+      {
+        auto excluded = exclude->find(it->first);
+        if (excluded != exclude->end() && excluded->second == node.GetXMLDump())
+        {
+          continue;
+        }
+      }
+      bool text_only = node.ChildrenBegin() == node.ChildrenEnd() && (!internal::tValueEncoding::IsEncoded(node));
+      entries.push_back(internal::tConfigBackend::tEntry { it->first.ToString(), text_only ? node.GetTextContent() : node.GetXMLDump(), !text_only });
+    }
+  }
+}
+
+std::shared_ptr<const internal::tConfigSnapshot> tConfigFile::GetSnapshot()
+{
+  std::shared_ptr<const internal::tConfigSnapshot> snapshot = std::atomic_load(&published_snapshot);
+  if (!snapshot)
+  {
+    PublishSnapshot();
+    snapshot = std::atomic_load(&published_snapshot);
+  }
+  return snapshot;
+}
+#endif
+
+/*!
+ * \param data Data
+ * \param size Size of data
+ * \return Fingerprint of data (FNV-1a hash)
+ */
+static uint64_t Fingerprint(const char* data, size_t size)
+{
+  uint64_t hash = cFNV_OFFSET_BASIS;
+  for (size_t i = 0; i < size; i++)
+  {
+    hash = (hash ^ static_cast<unsigned char>(data[i])) * cFNV_PRIME;
+  }
+  return hash;
+}
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+std::string tConfigFile::GetDocumentXML() const
+{
+  if (backend)
+  {
+    rrlib::xml::tDocument document;
+    if (backend->GetKind() == internal::tConfigBackend::tKind::COMPILED && core::FinrocFileExists(filename))
+    {
+      document = core::GetFinrocXMLDocument(filename, false);
+    }
+    else
+    {
+      document.AddRootNode(cXML_BRANCH_NAME);
+      ReconstructDocument(*backend, document);
+    }
+    return document.RootNode().GetXMLDump();
+  }
+  if (lazy_subtrees.empty())
+  {
+    return wrapped.RootNode().GetXMLDump();
+  }
+
+  // replace placeholders of subtrees that have not been parsed yet in a copy of the document (they occur in document order)
+  std::string xml = wrapped.RootNode().GetXMLDump();
+  rrlib::xml::tDocument document(xml.c_str(), xml.length() + 1);
+  std::vector<rrlib::xml::tNode*> placeholders;
+  for (rrlib::xml::tNode::iterator child = document.RootNode().ChildrenBegin(); child != document.RootNode().ChildrenEnd(); ++child)
+  {
+    if (child->Name() == cXML_LAZY_PLACEHOLDER_NAME)
+    {
+      placeholders.push_back(&(*child));
+    }
+  }
+  size_t placeholder_index = 0;
+  for (const tLazySubtree & subtree : lazy_subtrees)
+  {
+    if (subtree.placeholder && placeholder_index < placeholders.size())
+    {
+      rrlib::xml::tNode& placeholder = *placeholders[placeholder_index++];
+      std::string subtree_xml = lazy_xml.substr(subtree.offset, subtree.length);
+      rrlib::xml::tDocument fragment(subtree_xml.c_str(), subtree_xml.length() + 1);
+      placeholder.AddNextSibling(fragment.RootNode(), true);
+      document.RootNode().RemoveChildNode(placeholder);
+    }
+  }
+  return document.RootNode().GetXMLDump();
+}
+
+std::vector<tConfigFile::tDuplicateEntry> tConfigFile::GetDuplicateEntries()
+{
+  tModificationLock lock(*this);
+  MaterializeDocument();
+  std::vector<tDuplicateEntry> result;
+  for (auto & entry : duplicate_entries)
+  {
+    result.push_back(tDuplicateEntry { entry.ToString(), entry_index[entry].count });
+  }
+  return result;
+}
+#endif
+
+bool tConfigFile::GetEntryFingerprint(const internal::tConfigPath& entry, uint64_t& fingerprint)
+{
+  {
+    internal::tReadWriteLock::tSharedLock lock(access_lock);
+    if (backend)
+    {
+      internal::tConfigBackend::tValue value;
+      if (!backend->Find(entry, value))
+      {
+        return false;
+      }
+      fingerprint = Fingerprint(value.data, value.size) ^ (value.xml_fragment ? 1 : 0);
+      return true;
+    }
+  }
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  return ReadEntry<bool>(entry, [&fingerprint](rrlib::xml::tNode * node)
+  {
+    if (node)
+    {
+      std::string xml = node->GetXMLDump();
+      fingerprint = Fingerprint(xml.c_str(), xml.length());
+    }
+    return node != nullptr;
+  });
+#else
+  return false;
+#endif
+}
+
+std::string tConfigFile::GetStringEntry(const std::string& entry)
+{
+  internal::tConfigPath path(entry);
+  {
+    internal::tReadWriteLock::tSharedLock lock(access_lock);
+    if (backend)
+    {
+      internal::tConfigBackend::tValue value;
+      if (!backend->Find(path, value))
+      {
+        return "";
+      }
+#ifdef _LIB_RRLIB_XML_PRESENT_
+      if (value.xml_fragment)
+      {
+        std::string xml = value.ToString();
+        return rrlib::xml::tDocument(xml.c_str(), xml.length() + 1).RootNode().GetTextContent();
+      }
+#endif
+      return value.ToString();
+    }
+  }
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  return ReadEntry<std::string>(path, [](rrlib::xml::tNode * node)
+  {
+    return node ? node->GetTextContent() : std::string();
+  });
+#else
+  return "";
+#endif
+}
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+std::vector<std::string> tConfigFile::GetUnnamedEntries()
+{
+  tModificationLock lock(*this);
+  MaterializeDocument();
+  std::vector<std::string> result;
+  for (auto & entry : unnamed_entries)
+  {
+    result.push_back(entry.ToString());
+  }
+  return result;
+}
+#endif
+
+bool tConfigFile::HasEntry(const internal::tConfigPath& entry)
+{
+  {
+    internal::tReadWriteLock::tSharedLock lock(access_lock);
+    if (backend)
+    {
+      internal::tConfigBackend::tValue value;
+      return backend->Find(entry, value);
+    }
+  }
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  return ReadEntry<bool>(entry, [](rrlib::xml::tNode * node)
+  {
+    return node != nullptr;
+  });
+#else
+  return false;
+#endif
+}
+
+bool tConfigFile::HasEntry(const std::string& entry)
+{
+  return HasEntry(internal::tConfigPath(entry));
+}
+
+void tConfigFile::InvalidateParameterRegistries()
+{
+  binding_generation++;
+  tConfigNode::InvalidateCachedConfigNodes();
+}
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+void tConfigFile::LoadChangedParameterValues(const std::unordered_set<internal::tConfigPath>& changed_entries, tPendingLoads& pending_loads)
+{
+  assert(!access_lock.IsExclusivelyOwned());
+  core::tFrameworkElement* ann = GetAnnotated<core::tFrameworkElement>();
+  if (ann == nullptr)
+  {
+    return;
+  }
+  UpdateParameterRegistry();
+  for (internal::tParameterInfo* pi = first_registered_parameter; pi != nullptr; pi = pi->next_registered)
+  {
+    core::tAbstractPort* port = pi->GetAnnotated<core::tAbstractPort>();
+    if (port && port->IsReady() && changed_entries.count(pi->full_config_entry_path))
+    {
+      pending_loads.loads.emplace_back();
+      try
+      {
+        if (!pi->ResolveValueSources(pending_loads.loads.back(), false))
+        {
+          pending_loads.loads.pop_back();
+        }
+      }
+      catch (const std::exception& e)
+      {
+        pending_loads.loads.pop_back();
+        FINROC_LOG_PRINT(ERROR, e);
+      }
+    }
+  }
+  for (internal::tStaticParameterList* list = first_registered_static_parameter_list; list != nullptr; list = list->next_registered)
+  {
+    for (size_t i = 0; i < list->Size(); i++)
+    {
+      internal::tStaticParameterImplementationBase& parameter = list->Get(i);
+      if (changed_entries.count(parameter.GetFullConfigEntryPath()))
+      {
+        parameter.LoadValue();
+      }
+    }
+  }
+}
+
+bool tConfigFile::LoadLazily(const std::string& file)
+{
+  std::ifstream stream(file, std::ios::binary);
+  std::string xml((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+  std::string root_start_tag;
+  std::vector<tTopLevelElement> elements;
+  if ((!stream) || (!ScanXMLStructure(xml, root_start_tag, elements)))
+  {
+    FINROC_LOG_PRINT(DEBUG, "Config file '", file, "' cannot be loaded lazily. Parsing complete file.");
+    return false;
+  }
+
+  // Create document with root element and placeholders for all top-level subtrees
+  std::string skeleton = root_start_tag;
+  if (skeleton[skeleton.length() - 2] != '/')
+  {
+    size_t name_end = skeleton.find_first_of(" \t\r\n/>", 1);
+    skeleton += "</" + skeleton.substr(1, name_end - 1) + ">";
+  }
+  rrlib::xml::tDocument document(skeleton.c_str(), skeleton.length() + 1);
+  std::vector<tLazySubtree> subtrees;
+  for (const tTopLevelElement & element : elements)
+  {
+    subtrees.push_back(tLazySubtree { element.offset, element.length, &document.RootNode().AddChildNode(cXML_LAZY_PLACEHOLDER_NAME) });
+  }
+
+  wrapped = std::move(document);
+  entry_index.clear();
+  duplicate_entries.clear();
+  unnamed_entries.clear();
+  lazy_subtrees = std::move(subtrees);
+  lazy_subtree_index.clear();
+  for (size_t i = 0; i < elements.size(); i++)
+  {
+    internal::tConfigPath name(elements[i].name);
+    if (!name.Empty())
+    {
+      lazy_subtree_index[name[0]].push_back(i);
+    }
+  }
+  lazy_xml = std::move(xml);
+  return true;
+}
+
+void tConfigFile::LoadLayers(bool optional)
+{
+  ClearLazySubtrees();
+  backend.reset();
+  wrapped = rrlib::xml::tDocument();
+  wrapped.AddRootNode(cXML_BRANCH_NAME);
+  entry_index.clear();
+  duplicate_entries.clear();
+  unnamed_entries.clear();
+  layer_base.clear();
+  for (size_t i = 0; i < layers.size(); i++)
+  {
+    if (i == layers.size() - 1)
+    {
+      // remember entries of layers below top layer
+      for (auto & entry : entry_index)
+      {
+        if (entry.second.node->Name() == cXML_LEAF_NAME)
+        {
+          layer_base.emplace(entry.first, entry.second.node->GetXMLDump());
+        }
+      }
+    }
+    const std::string& layer = layers[i];
+    if (!core::FinrocFileExists(layer))
+    {
+      if (!optional)
+      {
+        FINROC_LOG_PRINT(WARNING, "Specified config file not found: ", layer);
+      }
+      continue;
+    }
+
+    try
+    {
+      if (internal::tFlatConfig::IsFlatFile(layer))
+      {
+        internal::tFlatConfig flat_layer(core::GetFinrocFile(layer));
+        for (size_t j = 0; j < flat_layer.Size(); j++)
+        {
+          internal::tConfigBackend::tValue value = flat_layer.GetValue(j);
+          std::string xml = value.xml_fragment ? value.ToString() : std::string();
+          rrlib::xml::tDocument fragment = value.xml_fragment ? rrlib::xml::tDocument(xml.c_str(), xml.length() + 1) : rrlib::xml::tDocument();
+          if (!value.xml_fragment)
+          {
+            fragment.AddRootNode(cXML_LEAF_NAME).SetContent(value.ToString());
+          }
+          ApplyChange(internal::tConfigPath(flat_layer.GetName(j)), &fragment.RootNode());
+        }
+      }
+      else if (entry_index.empty())
+      {
+        wrapped = core::GetFinrocXMLDocument(layer, false);
+        RebuildEntryIndex();
+      }
+      else
+      {
+        rrlib::xml::tDocument document = core::GetFinrocXMLDocument(layer, false);
+        std::vector<std::pair<internal::tConfigPath, rrlib::xml::tNode*>> leaf_entries;
+        internal::tConfigPath entry;
+        CollectLeafEntries(document.RootNode(), entry, leaf_entries);
+        for (auto & leaf_entry : leaf_entries)
+        {
+          ApplyChange(leaf_entry.first, leaf_entry.second);
+        }
+      }
+    }
+    catch (const std::exception& e)
+    {
+      FINROC_LOG_PRINT(ERROR, "Failed to load layer '", layer, "' of config file: ", e);
+    }
+  }
+}
+#endif
+
+void tConfigFile::LoadParameterValues(bool force_publish)
+{
+  LoadParameterValues(*GetAnnotated<core::tFrameworkElement>(), force_publish);
+}
+
+void tConfigFile::LoadParameterValues(core::tFrameworkElement& fe, bool force_publish)
+{
+  // Resolve sources of all values while holding structure mutex...
+  std::vector<internal::tParameterInfo::tPendingLoad> loads;
+  {
+    rrlib::thread::tLock lock(fe.GetStructureMutex());  // nothing should change while we're doing this
+    UpdateParameterRegistry();
+    bool all_parameters = (&fe == GetAnnotated<core::tFrameworkElement>());
+    for (internal::tParameterInfo* pi = first_registered_parameter; pi != nullptr;)
+    {
+      internal::tParameterInfo* next = pi->next_registered;
+      core::tAbstractPort* port = pi->GetAnnotated<core::tAbstractPort>();
+      if (port && port->IsReady() && (all_parameters || port == &fe || port->IsChildOf(fe)))    // Does element belong to specified framework element?
+      {
+        loads.emplace_back();
+        try
+        {
+          if (!pi->ResolveValueSources(loads.back(), false))
+          {
+            loads.pop_back();
+          }
+        }
+        catch (const std::exception& e)
+        {
+          loads.pop_back();
+          FINROC_LOG_PRINT_STATIC(ERROR, e);
+        }
+      }
+      pi = next;
+    }
+  }
+
+  // ...and deserialize and publish them without it (ports and config files are deleted deferred)
+  internal::tParameterInfo::LoadValues(loads, force_publish);
+}
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+rrlib::xml::tNode* tConfigFile::LookupEntry(const internal::tConfigPath& entry)
+{
+  auto it = entry_index.find(entry);
+  if (it == entry_index.end() || it->second.node->Name() != cXML_LEAF_NAME)
+  {
+    return nullptr;
+  }
+  return it->second.node;
+}
+#endif
+
+void tConfigFile::MarkParameterValuesChanged()
+{
+  for (internal::tParameterInfo* pi = first_registered_parameter; pi != nullptr; pi = pi->next_registered)
+  {
+    pi->value_changed = true;
+  }
+}
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+void tConfigFile::MaterializeDocument()
+{
+  if (lazy_subtrees.size())
+  {
+    for (size_t i = 0; i < lazy_subtrees.size(); i++)
+    {
+      MaterializeSubtree(i);
+    }
+    ClearLazySubtrees();
+  }
+  if (!backend)
+  {
+    return;
+  }
+  std::unique_ptr<internal::tConfigBackend> source = std::move(backend);
+  if (source->GetKind() == internal::tConfigBackend::tKind::COMPILED && core::FinrocFileExists(filename))  // flat config files may have been modified - so document is always created from them
+  {
+    try
+    {
+      wrapped = core::GetFinrocXMLDocument(filename, false);
+      RebuildEntryIndex();
+      return;
+    }
+    catch (const std::exception& e)
+    {
+      FINROC_LOG_PRINT(ERROR, e);
+    }
+  }
+
+  // reconstruct document from backend
+  wrapped = rrlib::xml::tDocument();
+  wrapped.AddRootNode(cXML_BRANCH_NAME);
+  ReconstructDocument(*source, wrapped);
+  RebuildEntryIndex();
+}
+#endif
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+void tConfigFile::MaterializeSubtree(size_t index)
+{
+  tLazySubtree& subtree = lazy_subtrees[index];
+  if (!subtree.placeholder)
+  {
+    return;
+  }
+  rrlib::xml::tNode& placeholder = *subtree.placeholder;
+  subtree.placeholder = nullptr;
+  try
+  {
+    std::string xml = lazy_xml.substr(subtree.offset, subtree.length);
+    rrlib::xml::tDocument fragment(xml.c_str(), xml.length() + 1);
+    tXMLNode& node = placeholder.AddNextSibling(fragment.RootNode(), true);
+    internal::tConfigPath entry;
+    AddToEntryIndex(node, entry);
+  }
+  catch (const std::exception& e)
+  {
+    FINROC_LOG_PRINT(ERROR, "Failed to parse subtree of config file '", filename, "': ", e);
+  }
+  wrapped.RootNode().RemoveChildNode(placeholder);
+}
+
+void tConfigFile::MaterializeSubtrees(const internal::tConfigPath& entry)
+{
+  if (backend)
+  {
+    MaterializeDocument();
+    return;
+  }
+  if (lazy_subtree_index.empty() || entry.Empty())
+  {
+    return;
+  }
+
+  // Parse all subtrees whose name starts with first segment of entry (in document order)
+  auto it = lazy_subtree_index.find(entry[0]);
+  if (it != lazy_subtree_index.end())
+  {
+    std::vector<size_t> subtrees = std::move(it->second);
+    lazy_subtree_index.erase(it);
+    for (size_t index : subtrees)
+    {
+      MaterializeSubtree(index);
+    }
+  }
+  if (lazy_subtree_index.empty())
+  {
+    MaterializeDocument(); // parses any remaining unnamed subtrees and frees XML file content
+  }
+}
+#endif
+
+void tConfigFile::Preload(const std::vector<std::string>& filenames, unsigned int thread_count)
+{
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  struct tJob
+  {
+    std::vector<std::string> filenames;
+    std::vector<std::promise<std::unique_ptr<rrlib::xml::tDocument>>> results;
+    std::atomic<size_t> next_index;
+  };
+  std::shared_ptr<tJob> job(new tJob());
+  job->next_index = 0;
+
+  tPreloadedDocuments& preloaded = PreloadedDocuments();
+  {
+    rrlib::thread::tLock lock(preloaded.mutex);
+    for (const std::string & filename : filenames)
+    {
+      if (preloaded.documents.count(filename) == 0 && core::FinrocFileExists(filename))
+      {
+        job->filenames.push_back(filename);
+        job->results.emplace_back();
+        preloaded.documents[filename] = job->results.back().get_future();
+      }
+    }
+  }
+  if (job->filenames.empty())
+  {
+    return;
+  }
+
+  thread_count = thread_count ? thread_count : std::max(1u, std::thread::hardware_concurrency());
+  thread_count = std::min<size_t>(thread_count, job->filenames.size());
+  std::vector<std::future<void>> workers;
+  for (unsigned int i = 0; i < thread_count; i++)
+  {
+    workers.push_back(std::async(std::launch::async, [job]()
+    {
+      size_t index;
+      while ((index = job->next_index++) < job->filenames.size())
+      {
+        try
+        {
+          job->results[index].set_value(std::unique_ptr<rrlib::xml::tDocument>(new rrlib::xml::tDocument(core::GetFinrocXMLDocument(job->filenames[index], false))));
+        }
+        catch (...)
+        {
+          job->results[index].set_exception(std::current_exception());
+        }
+      }
+    }));
+  }
+
+  rrlib::thread::tLock lock(preloaded.mutex);
+  auto& all_workers = preloaded.workers;
+  all_workers.erase(std::remove_if(all_workers.begin(), all_workers.end(), [](std::future<void>& worker)
+  {
+    return worker.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+  }), all_workers.end());
+  for (auto & worker : workers)
+  {
+    all_workers.push_back(std::move(worker));
+  }
+#endif
+}
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+void tConfigFile::PublishSnapshot()
+{
+  tModificationLock lock(*this);
+  MaterializeDocument();
+  std::shared_ptr<const internal::tConfigSnapshot> current = std::atomic_load(&published_snapshot);
+  if (current && current->GetLineage() == lineage && current->GetRevision() == revision)
+  {
+    return;
+  }
+
+  auto get_value = [](const tIndexEntry & entry)
+  {
+    return entry.node->Name() == cXML_LEAF_NAME ? std::make_shared<const std::string>(entry.node->GetXMLDump()) : internal::tConfigSnapshot::tValue();
+  };
+  std::vector<internal::tConfigSnapshot::tChange> changes;
+  if (current && current->GetLineage() == lineage && current->GetRevision() >= change_log_start && current->GetRevision() < revision)
+  {
+    // change log covers all changes since current snapshot => only copy paths to changed entries
+    std::unordered_set<internal::tConfigPath> changed_entries;
+    for (auto it = change_log.rbegin(); it != change_log.rend() && it->first > current->GetRevision(); ++it)
+    {
+      if (changed_entries.insert(it->second).second)
+      {
+        auto entry = entry_index.find(it->second);
+        changes.emplace_back(it->second, entry != entry_index.end() ? get_value(entry->second) : internal::tConfigSnapshot::tValue());
+      }
+    }
+    std::atomic_store(&published_snapshot, current->With(changes, lineage, revision));
+    return;
+  }
+
+  for (auto & entry : entry_index)
+  {
+    if (entry.second.node->Name() == cXML_LEAF_NAME)
+    {
+      changes.emplace_back(entry.first, get_value(entry.second));
+    }
+  }
+  std::atomic_store(&published_snapshot, internal::tConfigSnapshot::Create(changes, lineage, revision));
+}
+
+void tConfigFile::ReloadFile(tPendingLoads& pending_loads)
+{
+  std::unordered_set<internal::tConfigPath> changed_entries;
+  {
+    tModificationLock lock(*this);
+
+    // entries before reloading (taken from backend if one is used - materializing document would load the new file)
+    std::vector<internal::tConfigBackend::tEntry> old_entries;
+    if (backend)
+    {
+      GetBackendEntries(*backend, old_entries);
+    }
+    else
+    {
+      GetLeafEntries(old_entries);
+    }
+
+    if (layers.empty())
+    {
+      try
+      {
+        if (internal::tFlatConfig::IsFlatFile(filename))
+        {
+          std::unique_ptr<internal::tConfigBackend> flat_file(new internal::tFlatConfig(core::GetFinrocFile(filename)));
+          ClearLazySubtrees();
+          wrapped = rrlib::xml::tDocument();
+          wrapped.AddRootNode(cXML_BRANCH_NAME);
+          RebuildEntryIndex();
+          backend = std::move(flat_file);
+        }
+        else
+        {
+          rrlib::xml::tDocument document = core::GetFinrocXMLDocument(filename, false);
+          ClearLazySubtrees();
+          backend.reset();
+          wrapped = std::move(document);
+          RebuildEntryIndex();
+        }
+      }
+      catch (const std::exception& e)
+      {
+        FINROC_LOG_PRINT(WARNING, "Could not reload modified config file '", filename, "': ", e);
+        return;
+      }
+    }
+    else
+    {
+      LoadLayers(true);
+    }
+
+    // determine changed leaf entries
+    std::vector<internal::tConfigBackend::tEntry> new_entries;
+    if (backend)
+    {
+      GetBackendEntries(*backend, new_entries);
+    }
+    else
+    {
+      GetLeafEntries(new_entries);
+    }
+    std::unordered_map<std::string, const internal::tConfigBackend::tEntry*> old_entry_index;
+    for (auto & entry : old_entries)
+    {
+      old_entry_index.emplace(entry.name, &entry);
+    }
+    for (auto & entry : new_entries)
+    {
+      auto old_entry = old_entry_index.find(entry.name);
+      if (old_entry == old_entry_index.end() || old_entry->second->value != entry.value || old_entry->second->xml_fragment != entry.xml_fragment)
+      {
+        changed_entries.insert(internal::tConfigPath(entry.name));
+      }
+      if (old_entry != old_entry_index.end())
+      {
+        old_entry_index.erase(old_entry);
+      }
+    }
+    for (auto & removed_entry : old_entry_index)
+    {
+      changed_entries.insert(internal::tConfigPath(removed_entry.first));
+    }
+    if (changed_entries.empty())
+    {
+      return;
+    }
+    FINROC_LOG_PRINT(DEBUG, "Config file '", filename, "' was modified (", changed_entries.size(), " changed entries). Reloading affected parameters.");
+    for (auto & entry : changed_entries)
+    {
+      EntryChanged(entry);
+    }
+    if (std::atomic_load(&published_snapshot))
+    {
+      PublishSnapshot();
+    }
+  }
+
+  // exclusive lock is released: values are loaded by the caller
+  LoadChangedParameterValues(changed_entries, pending_loads);
+}
+
+void tConfigFile::RebuildEntryIndex()
+{
+  entry_index.clear();
+  duplicate_entries.clear();
+  unnamed_entries.clear();
+  internal::tConfigPath entry;
+  for (rrlib::xml::tNode::iterator child = wrapped.RootNode().ChildrenBegin(); child != wrapped.RootNode().ChildrenEnd(); ++child)
+  {
+    AddToEntryIndex(*child, entry);
+  }
+}
+#endif
+
+void tConfigFile::RegisterParameter(internal::tParameterInfo& parameter)
+{
+  if (parameter.registered_config_file == this)
+  {
+    return;
+  }
+  UnregisterParameter(parameter);
+  parameter.registered_config_file = this;
+  parameter.value_changed = true;  // value is not known to be up to date in this config file
+  parameter.previous_registered = nullptr;
+  parameter.next_registered = first_registered_parameter;
+  if (first_registered_parameter)
+  {
+    first_registered_parameter->previous_registered = &parameter;
+  }
+  first_registered_parameter = &parameter;
+}
+
+void tConfigFile::RegisterStaticParameters(internal::tStaticParameterList& list)
+{
+  if (list.registered_config_file == this)
+  {
+    return;
+  }
+  UnregisterStaticParameters(list);
+  list.registered_config_file = this;
+  list.previous_registered = nullptr;
+  list.next_registered = first_registered_static_parameter_list;
+  if (first_registered_static_parameter_list)
+  {
+    first_registered_static_parameter_list->previous_registered = &list;
+  }
+  first_registered_static_parameter_list = &list;
+}
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+void tConfigFile::ReplaceDocument(rrlib::xml::tDocument && document, uint64_t new_lineage, uint64_t new_revision)
+{
+  wrapped = std::move(document);
+  backend.reset();
+  ClearLazySubtrees();
+  RebuildEntryIndex();
+  MarkParameterValuesChanged();
+  StartHistory(new_lineage, new_revision);
+}
+
+void tConfigFile::RestoreSnapshot(const std::shared_ptr<const internal::tConfigSnapshot>& snapshot)
+{
+  std::unordered_set<internal::tConfigPath> changed_entries;
+  {
+    tModificationLock lock(*this);
+    PublishSnapshot();
+    std::shared_ptr<const internal::tConfigSnapshot> current = std::atomic_load(&published_snapshot);
+    std::vector<internal::tConfigPath> changed;
+    internal::tConfigSnapshot::Diff(*current, *snapshot, changed);
+    if (changed.empty())
+    {
+      return;
+    }
+
+    for (auto & entry : changed)
+    {
+      try
+      {
+        ApplyChange(entry, snapshot->Find(entry));
+      }
+      catch (const std::exception& e)
+      {
+        FINROC_LOG_PRINT(ERROR, "Could not restore config entry '", entry.ToString(), "': ", e);
+      }
+      EntryChanged(entry);
+      changed_entries.insert(entry);
+    }
+
+    // restored snapshot is current state (with new revision)
+    std::atomic_store(&published_snapshot, snapshot->With(std::vector<internal::tConfigSnapshot::tChange>(), lineage, revision));
+  }
+
+  tPendingLoads pending_loads;
+  LoadChangedParameterValues(changed_entries, pending_loads);
+  internal::tParameterInfo::LoadValues(pending_loads.loads);
+}
+#endif
+
+void tConfigFile::SaveFile(const std::string& new_filename)
+{
+  bool flat = false;
+  bool save_backend = false;
+  std::shared_ptr<tHotReloadState> hot_reload;
+  {
+    tModificationLock lock(*this); // nothing should change while we're doing this
+    hot_reload = hot_reload_state;
+    if (new_filename.length() > 0)
+    {
+      this->filename = new_filename;
+#ifdef _LIB_RRLIB_XML_PRESENT_
+      if (layers.size())
+      {
+        layers.back() = new_filename;
+      }
+#endif
+    }
+    flat = internal::tFlatConfig::IsFlatFile(this->filename);
+    save_backend = flat && IsFlat();  // flat config file that has not been converted to XML document
+#ifdef _LIB_RRLIB_XML_PRESENT_
+    if (!save_backend)
+    {
+      MaterializeDocument();
+    }
+#else
+    if (!save_backend)
+    {
+      FINROC_LOG_PRINT(ERROR, "Cannot save config file '", this->filename, "': only flat config files can be saved without XML support");
+      return;
+    }
+#endif
+
+    // first: update tree
+    if (GetAnnotated<core::tFrameworkElement>())
+    {
+      UpdateParameterRegistry();
+      for (internal::tParameterInfo* pi = first_registered_parameter; pi != nullptr; pi = pi->next_registered)
+      {
+        core::tAbstractPort* port = pi->GetAnnotated<core::tAbstractPort>();
+        if (port && port->IsReady() && pi->ValueChanged())    // parameters with unchanged values are already up to date in tree
+        {
+          try
+          {
+            pi->SaveValue();
+          }
+          catch (const std::exception& e)
+          {
+            FINROC_LOG_PRINT_STATIC(ERROR, e);
+          }
+        }
+      }
+#ifdef _LIB_RRLIB_XML_PRESENT_
+      if ((!save_backend) && std::atomic_load(&published_snapshot))
+      {
+        PublishSnapshot();
+      }
+#endif
+    }
+  }
+
+  try
+  {
+    std::string save_to = core::GetFinrocFileToSaveTo(this->filename);
+    if (save_to.length() == 0)
+    {
+      std::string save_to_alt = save_to;
+      std::replace(save_to_alt.begin(), save_to_alt.end(), '/', '_'); // Replace '/' characters with '_'
+      save_to_alt = core::GetFinrocFileToSaveTo(save_to_alt);
+      FINROC_LOG_PRINT(ERROR, "There does not seem to be any suitable location for: '", this->filename, "' . For now, using '", save_to_alt, "'.");
+      save_to = save_to_alt;
+    }
+
+    // create file content while holding lock (document is only read - parameters may still load their values)
+    std::string content;
+    {
+      internal::tReadWriteLock::tSharedLock lock(access_lock);
+      if (save_backend)
+      {
+        content = backend->GetFileContent();
+      }
 #ifdef _LIB_RRLIB_XML_PRESENT_
-  wrapped(),
+      else if (flat)
+      {
+        std::vector<internal::tConfigBackend::tEntry> entries;
+        GetLeafEntries(entries, layers.size() ? &layer_base : nullptr);  // layered config file: top layer only contains entries that differ from layers below
+        std::sort(entries.begin(), entries.end(), [](const internal::tConfigBackend::tEntry & a, const internal::tConfigBackend::tEntry & b)
+        {
+          return a.name < b.name;
+        });
+        content = internal::tFlatConfig::GetFileContent(entries);
+      }
+      else if (layers.size())
+      {
+        // top layer only contains entries that differ from layers below
+        std::string xml = wrapped.RootNode().GetXMLDump();
+        rrlib::xml::tDocument top_layer(xml.c_str(), xml.length() + 1);
+        internal::tConfigPath entry;
+        RemoveLeafEntries(top_layer.RootNode(), entry, layer_base);
+        content = GetXMLFileContent(top_layer.RootNode());
+      }
+      else
+      {
+        content = GetXMLFileContent(wrapped.RootNode());
+      }
 #endif
-  filename(filename),
-  active(true)
-{
-#ifdef _LIB_RRLIB_XML_PRESENT_
-  if (core::FinrocFileExists(filename))
-  {
-    try
+    }
+
+    // write content to temporary file and replace file atomically (so that there is never a truncated config file)
+    std::string temp_file = save_to + ".tmp";
     {
-      wrapped = core::GetFinrocXMLDocument(filename, false); // false = do not validate with dtd
-      return;
+      std::ofstream stream(temp_file, std::ios::binary | std::ios::trunc);
+      stream.write(content.data(), content.length());
+      stream.close();
+      if (!stream)
+      {
+        std::remove(temp_file.c_str());
+        throw std::runtime_error("Could not write config file '" + temp_file + "'");
+      }
     }
-    catch (const std::exception& e)
+    int fd = open(temp_file.c_str(), O_RDONLY);
+    if (fd >= 0)
     {
-      FINROC_LOG_PRINT(ERROR, e);
+      fsync(fd);
+      close(fd);
+    }
+
+    // replaced file is not to be reloaded (renaming preserves status of temporary file)
+    struct stat file_info;
+    if (hot_reload && stat(temp_file.c_str(), &file_info) == 0)
+    {
+      rrlib::thread::tLock lock(hot_reload->mutex);
+      hot_reload->own_write = file_info;
+      hot_reload->own_write_valid = true;
+    }
+    if (std::rename(temp_file.c_str(), save_to.c_str()) != 0)
+    {
+      std::remove(temp_file.c_str());
+      throw std::runtime_error("Could not replace config file '" + save_to + "': " + strerror(errno));
     }
   }
-  else if (!optional)
+  catch (const std::exception& e)
   {
-    FINROC_LOG_PRINT(WARNING, "Specified config file not found: ", filename);
+    FINROC_LOG_PRINT(ERROR, e);
   }
-  wrapped = rrlib::xml::tDocument();
-  wrapped.AddRootNode(cXML_BRANCH_NAME);
-#endif
 }
 
 #ifdef _LIB_RRLIB_XML_PRESENT_
-rrlib::xml::tNode& tConfigFile::CreateEntry(const std::string& entry, bool leaf)
+void tConfigFile::SerializeChanges(rrlib::serialization::tOutputStream& stream, uint64_t known_lineage, uint64_t known_revision) const
 {
-  if (!leaf)
+  internal::tReadWriteLock::tSharedLock lock(access_lock);
+  stream.WriteLong(static_cast<int64_t>(lineage));
+  stream.WriteLong(static_cast<int64_t>(revision));
+
+  // Does change log cover all changes since the receiver's revision? (changes are only looked up in document - not in backends)
+  bool delta = (!backend) && known_lineage == lineage && known_revision >= change_log_start && known_revision <= revision;
+  stream.WriteBoolean(delta);
+  if (!delta)
+  {
+    stream.WriteString(GetDocumentXML());
+    return;
+  }
+
+  std::vector<const internal::tConfigPath*> changed_entries;
+  std::unordered_set<internal::tConfigPath> contained;
+  for (auto it = change_log.rbegin(); it != change_log.rend() && it->first > known_revision; ++it)
   {
-    std::vector<rrlib::xml::tNode*> result;
-    GetEntryImplementation(result, entry, wrapped.RootNode(), 0);
-    if (result.size() > 0)
+    if (contained.insert(it->second).second)
     {
-      // do we want to warn if node is a leaf node? - I currently do not think so
-      return *result[0];
+      changed_entries.push_back(&it->second);
+    }
+  }
+  stream.WriteLong(static_cast<int64_t>(known_revision));
+  stream.WriteInt(static_cast<int>(changed_entries.size()));
+  for (auto it = changed_entries.rbegin(); it != changed_entries.rend(); ++it)
+  {
+    auto index_entry = entry_index.find(**it);
+    bool exists = index_entry != entry_index.end();
+    stream.WriteBoolean(exists);
+    stream.WriteString((*it)->ToString());
+    if (exists)
+    {
+      stream.WriteString(index_entry->second.node->GetXMLDump());
     }
   }
-
-  size_t slash_index = entry.rfind('/');
-  tXMLNode& parent = (slash_index == std::string::npos || slash_index == 0) ? wrapped.RootNode() : CreateEntry(entry.substr(0, slash_index), false);
-  tXMLNode& created = parent.AddChildNode(leaf ? cXML_LEAF_NAME : cXML_BRANCH_NAME);
-  created.SetAttribute("name", (slash_index == std::string::npos) ? entry : entry.substr(slash_index + 1));
-  return created;
 }
 #endif
 
-tConfigFile* tConfigFile::Find(const core::tFrameworkElement& element)
+void tConfigFile::SerializeEntry(const internal::tConfigPath& entry, const rrlib::rtti::tGenericObject& object)
 {
-  tConfigFile* config_file = element.GetAnnotation<tConfigFile>();
-  if (config_file && config_file->active == true)
-  {
-    return config_file;
-  }
-  core::tFrameworkElement* parent = element.GetParent();
-  if (parent)
+  tModificationLock lock(*this);
+  if (IsFlat())
   {
-    return Find(*parent);
+    backend->SerializeEntry(entry, object);
+    EntryChanged(entry);
+    return;
   }
-  return NULL;
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  internal::tValueEncoding::Serialize(GetEntry(entry, true), object, binary_value_threshold);
+#else
+  throw std::runtime_error("Cannot modify config entry '" + entry.ToString() + "': compiled config files are read-only without XML support");
+#endif
 }
 
-#ifdef _LIB_RRLIB_XML_PRESENT_
-rrlib::xml::tNode& tConfigFile::GetEntry(const std::string& entry, bool create)
+void tConfigFile::SetBinaryValueThreshold(size_t threshold)
+{
+  binary_value_threshold = threshold;
+}
+
+void tConfigFile::SetSharedCacheEnabled(bool enabled)
+{
+  shared_cache_enabled = enabled;
+}
+
+void tConfigFile::StartHistory(uint64_t new_lineage, uint64_t new_revision)
 {
-  std::vector<rrlib::xml::tNode*> result;
-  GetEntryImplementation(result, entry, wrapped.RootNode(), 0);
-  if (result.size() > 1)
+  lineage = new_lineage;
+  revision = new_revision;
+  change_log.clear();
+  change_log_start = new_revision;
+}
+
+void tConfigFile::UnregisterParameter(internal::tParameterInfo& parameter)
+{
+  tConfigFile* config_file = parameter.registered_config_file;
+  if (!config_file)
+  {
+    return;
+  }
+  if (parameter.previous_registered)
   {
-    FINROC_LOG_PRINT(WARNING, "There are ", result.size(), " entries in config file with the qualified name '", entry, "'. Using the first one.");
+    parameter.previous_registered->next_registered = parameter.next_registered;
   }
-
-  if (!create)
+  else
   {
-    if (result.size() == 0)
-    {
-      throw std::runtime_error("Config node not found: " + entry);
-    }
-    if (result[0]->Name() != cXML_LEAF_NAME)
-    {
-      throw std::runtime_error("Config node is no leaf: " + entry);
-    }
-    return *result[0];
+    config_file->first_registered_parameter = parameter.next_registered;
+  }
+  if (parameter.next_registered)
+  {
+    parameter.next_registered->previous_registered = parameter.previous_registered;
   }
+  parameter.registered_config_file = nullptr;
+  parameter.next_registered = nullptr;
+  parameter.previous_registered = nullptr;
+}
 
-  // create node...
-  if (result.size() > 0)
+void tConfigFile::UnregisterStaticParameters(internal::tStaticParameterList& list)
+{
+  tConfigFile* config_file = list.registered_config_file;
+  if (!config_file)
   {
-    // recreate existing node
-    std::string name = result[0]->GetStringAttribute("name");
-    tXMLNode& parent = result[0]->Parent();
-    parent.RemoveChildNode(*result[0]);
-    tXMLNode& new_node = parent.AddChildNode(cXML_LEAF_NAME);
-    new_node.SetAttribute("name", name);
-    return new_node;
+    return;
+  }
+  if (list.previous_registered)
+  {
+    list.previous_registered->next_registered = list.next_registered;
   }
   else
   {
-    return CreateEntry(entry, true);
+    config_file->first_registered_static_parameter_list = list.next_registered;
+  }
+  if (list.next_registered)
+  {
+    list.next_registered->previous_registered = list.previous_registered;
   }
+  list.registered_config_file = nullptr;
+  list.next_registered = nullptr;
+  list.previous_registered = nullptr;
 }
 
-void tConfigFile::GetEntryImplementation(std::vector<rrlib::xml::tNode*>& result, const std::string& entry, rrlib::xml::tNode& node, size_t entry_string_index)
+void tConfigFile::UpdateParameterRegistry()
 {
-  if (entry_string_index >= entry.length())
+  int generation = binding_generation;
+  core::tFrameworkElement* ann = GetAnnotated<core::tFrameworkElement>();
+  if (registry_generation == generation || ann == nullptr)
   {
     return;
   }
 
-  // Check for slash at beginning
-  if (entry[entry_string_index] == '/')
+  // Remove parameters that are no longer configured from this config file
+  for (internal::tParameterInfo* pi = first_registered_parameter; pi != nullptr;)
   {
-    if (entry_string_index > 0)
+    internal::tParameterInfo* next = pi->next_registered;
+    core::tAbstractPort* port = pi->GetAnnotated<core::tAbstractPort>();
+    if (port == nullptr || Find(*port) != this)
     {
-      FINROC_LOG_PRINT(WARNING, "Entry '", entry, "' seems to be not clean (sequential slashes). Skipping one slash now, as this is typically intended. Please fix this!");
+      UnregisterParameter(*pi);
     }
-    entry_string_index++;
+    pi = next;
+  }
+  for (internal::tStaticParameterList* list = first_registered_static_parameter_list; list != nullptr;)
+  {
+    internal::tStaticParameterList* next = list->next_registered;
+    core::tFrameworkElement* element = list->GetAnnotated();
+    if (element == nullptr || Find(*element) != this)
+    {
+      UnregisterStaticParameters(*list);
+    }
+    list = next;
   }
 
-  // Search child nodes
-  for (rrlib::xml::tNode::iterator child = node.ChildrenBegin(); child != node.ChildrenEnd(); ++child)
+  // Add all parameters that are configured from this config file
+  for (auto it = ann->SubElementsBegin(true); it != ann->SubElementsEnd(); ++it)
   {
-    if (child->Name() == cXML_BRANCH_NAME || child->Name() == cXML_LEAF_NAME)
+    if (Find(*it) != this)    // Does element belong to this configuration file?
     {
-      try
+      continue;
+    }
+    if (it->IsPort())
+    {
+      internal::tParameterInfo* pi = it->GetAnnotation<internal::tParameterInfo>();
+      if (pi)
       {
-        std::string name_attribute = child->GetStringAttribute("name");
-        if (entry.compare(entry_string_index, name_attribute.length(), name_attribute) == 0) // starts_with name attribute?
-        {
-          size_t new_entry_string_index = entry_string_index + name_attribute.length();
-          if (new_entry_string_index != entry.length())
-          {
-            if (entry[new_entry_string_index] == '/')
-            {
-              new_entry_string_index++;
-              GetEntryImplementation(result, entry, *child, new_entry_string_index);
-            }
-          }
-          else
-          {
-            result.push_back(&(*child));
-          }
-        }
+        RegisterParameter(*pi);
       }
-      catch (const std::exception& e)
+    }
+    else
+    {
+      internal::tStaticParameterList* list = it->GetAnnotation<internal::tStaticParameterList>();
+      if (list)
       {
-        FINROC_LOG_PRINT(WARNING, "Encountered tree node without name");
+        RegisterStaticParameters(*list);
       }
     }
   }
+  registry_generation = generation;
+}
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+rrlib::xml::tNode* tConfigFile::TryGetEntry(const internal::tConfigPath& entry)
+{
+  tModificationLock lock(*this);
+  MaterializeSubtrees(entry);
+  return LookupEntry(entry);
+}
+
+rrlib::xml::tNode* tConfigFile::TryGetEntry(const std::string& entry)
+{
+  return TryGetEntry(internal::tConfigPath(entry));
+}
 
-  // Okay, we did not find any more
+void tConfigFile::WriteCompiledFile(const std::string& file)
+{
+  tModificationLock lock(*this);
+  std::vector<internal::tConfigBackend::tEntry> entries;
+  GetLeafEntries(entries);
+  bool single_file = layers.size() <= 1 && (!internal::tFlatConfig::IsFlatFile(filename)) && core::FinrocFileExists(filename);
+  internal::tCompiledConfig::Write(file, entries, single_file ? core::GetFinrocFile(filename) : std::string());
 }
 #endif
 
-std::string tConfigFile::GetStringEntry(const std::string& entry)
+rrlib::serialization::tOutputStream& operator << (rrlib::serialization::tOutputStream& stream, const tConfigFile& config_file)
 {
 #ifdef _LIB_RRLIB_XML_PRESENT_
+  internal::tReadWriteLock::tSharedLock lock(config_file.access_lock);
+  stream.WriteBoolean(config_file.IsActive());
+  stream.WriteString(config_file.GetFilename());
+
+  // transfer changes since revision last exchanged with peer (complete document if it is unknown)
+  std::lock_guard<std::mutex> synced_lock(config_file.synced_revision_mutex);
   try
   {
-    return GetEntry(entry).GetTextContent();
+    config_file.SerializeChanges(stream, config_file.synced_revision.first, config_file.synced_revision.second);
+    config_file.synced_revision = std::make_pair(config_file.lineage, config_file.revision);
   }
   catch (const std::exception& e)
   {
-    return "";
+    FINROC_LOG_PRINT_STATIC(ERROR, e); // Should never occur
   }
-#else
-  return "";
 #endif
+  return stream;
 }
 
-bool tConfigFile::HasEntry(const std::string& entry)
+rrlib::serialization::tInputStream& operator >> (rrlib::serialization::tInputStream& stream, tConfigFile& config_file)
 {
 #ifdef _LIB_RRLIB_XML_PRESENT_
-  // TODO: could be implemented more efficiently
-  try
+  tConfigFile::tModificationLock lock(config_file);
+  bool active = stream.ReadBoolean();
+  if (active != config_file.active)
   {
-    GetEntry(entry);
-    return true;
+    config_file.active = active;
+    tConfigFile::InvalidateParameterRegistries();
   }
-  catch (const std::exception& e)
+  std::string file = stream.ReadString();
+  uint64_t sender_lineage = static_cast<uint64_t>(stream.ReadLong());
+  uint64_t sender_revision = static_cast<uint64_t>(stream.ReadLong());
+  bool delta = stream.ReadBoolean();
+  std::lock_guard<std::mutex> synced_lock(config_file.synced_revision_mutex);
+  if (delta)
   {
-    return false;
+    if (config_file.DeserializeDelta(stream, sender_lineage, sender_revision, config_file.active))
+    {
+      config_file.synced_revision = std::make_pair(sender_lineage, sender_revision);
+    }
+    else if (config_file.active)
+    {
+      FINROC_LOG_PRINT_STATIC(WARNING, "Ignored changes of config file '", config_file.filename, "' that are based on a different revision. Sending complete document next time.");
+      config_file.synced_revision = std::make_pair(0, 0);
+    }
+    if (config_file.active && file.length() > 0)
+    {
+      config_file.filename = file;
+    }
   }
-#else
-  return false;
-#endif
-}
-
-void tConfigFile::LoadParameterValues()
-{
-  LoadParameterValues(*GetAnnotated<core::tFrameworkElement>());
-}
-
-void tConfigFile::LoadParameterValues(core::tFrameworkElement& fe)
-{
-  rrlib::thread::tLock lock(fe.GetStructureMutex());  // nothing should change while we're doing this
-  for (auto it = fe.SubElementsBegin(true); it != fe.SubElementsEnd(); ++it)
+  else
   {
-    if (it->IsPort() && it->IsReady() && Find(*it) == this)    // Does element belong to this configuration file?
+    std::string content = stream.ReadString();
+    if (config_file.active && file.length() > 0 && content.length() == 0 && (file != config_file.filename))
     {
-      internal::tParameterInfo* pi = it->GetAnnotation<internal::tParameterInfo>();
-      if (pi)
+      // load file
+      if (core::FinrocFileExists(file))
       {
+        config_file.backend.reset();
+        config_file.ClearLazySubtrees();
+        config_file.layers.clear();
+        config_file.layer_base.clear();
         try
         {
-          pi->LoadValue();
+          if (internal::tFlatConfig::IsFlatFile(file))
+          {
+            config_file.backend.reset(new internal::tFlatConfig(core::GetFinrocFile(file)));
+            config_file.wrapped = rrlib::xml::tDocument();
+            config_file.wrapped.AddRootNode(cXML_BRANCH_NAME);
+          }
+          else
+          {
+            config_file.wrapped = core::GetFinrocXMLDocument(file, false);
+          }
         }
         catch (const std::exception& e)
         {
           FINROC_LOG_PRINT_STATIC(ERROR, e);
-        }
-      }
-    }
-  }
-}
-
-void tConfigFile::SaveFile(const std::string& new_filename)
-{
-#ifdef _LIB_RRLIB_XML_PRESENT_
-  // first: update tree
-  core::tFrameworkElement* ann = GetAnnotated<core::tFrameworkElement>();
-  if (ann)
-  {
-    rrlib::thread::tLock lock(ann->GetStructureMutex()); // nothing should change while we're doing this
-    for (auto it = ann->SubElementsBegin(true); it != ann->SubElementsEnd(); ++it)
-    {
-      if (it->IsPort() && it->IsReady() && Find(*it) == this)    // Does element belong to this configuration file?
-      {
-        internal::tParameterInfo* pi = it->GetAnnotation<internal::tParameterInfo>();
-        if (pi)
-        {
+          config_file.wrapped = rrlib::xml::tDocument();
           try
           {
-            pi->SaveValue();
+            config_file.wrapped.AddRootNode(cXML_BRANCH_NAME);
           }
-          catch (const std::exception& e)
+          catch (const std::exception& e1)
           {
-            FINROC_LOG_PRINT_STATIC(ERROR, e);
+            FINROC_LOG_PRINT_STATIC(ERROR, e1);
           }
         }
+        config_file.RebuildEntryIndex();
+        config_file.MarkParameterValuesChanged();
+        config_file.StartHistory(config_file.own_lineage, config_file.revision + 1);  // document loaded from file starts a new history
+        config_file.synced_revision = std::make_pair(0, 0);
       }
+      config_file.filename = file;
     }
-  }
-
-  try
-  {
-    if (new_filename.length() > 0)
-    {
-      this->filename = new_filename;
-    }
-    std::string save_to = core::GetFinrocFileToSaveTo(this->filename);
-    if (save_to.length() == 0)
+    else if (config_file.active && content.length() > 0)
     {
-      std::string save_to_alt = save_to;
-      std::replace(save_to_alt.begin(), save_to_alt.end(), '/', '_'); // Replace '/' characters with '_'
-      save_to_alt = core::GetFinrocFileToSaveTo(save_to_alt);
-      FINROC_LOG_PRINT(ERROR, "There does not seem to be any suitable location for: '", this->filename, "' . For now, using '", save_to_alt, "'.");
-      save_to = save_to_alt;
-    }
-
-    // write new tree to file
-    wrapped.WriteToFile(save_to);
-  }
-  catch (const std::exception& e)
-  {
-    FINROC_LOG_PRINT(ERROR, e);
-  }
-#endif
-}
-
-rrlib::serialization::tOutputStream& operator << (rrlib::serialization::tOutputStream& stream, const tConfigFile& config_file)
-{
-#ifdef _LIB_RRLIB_XML_PRESENT_
-  stream.WriteBoolean(config_file.IsActive());
-  stream.WriteString(config_file.GetFilename());
-
-  try
-  {
-    stream.WriteString(config_file.wrapped.RootNode().GetXMLDump());
-  }
-  catch (const std::exception& e)
-  {
-    FINROC_LOG_PRINT_STATIC(ERROR, e); // Should never occur
-  }
-#endif
-  return stream;
-}
-
-rrlib::serialization::tInputStream& operator >> (rrlib::serialization::tInputStream& stream, tConfigFile& config_file)
-{
-#ifdef _LIB_RRLIB_XML_PRESENT_
-  config_file.active = stream.ReadBoolean();
-  std::string file = stream.ReadString();
-  std::string content = stream.ReadString();
+      if (file.length() > 0)
+      {
+        config_file.filename = file;
+      }
 
-  if (config_file.active && file.length() > 0 && content.length() == 0 && (file != config_file.filename))
-  {
-    // load file
-    if (core::FinrocFileExists(file))
-    {
       try
       {
-        config_file.wrapped = core::GetFinrocXMLDocument(file, false);
+        config_file.ReplaceDocument(rrlib::xml::tDocument(content.c_str(), content.length() + 1), sender_lineage, sender_revision);
+        config_file.synced_revision = std::make_pair(sender_lineage, sender_revision);
       }
       catch (const std::exception& e)
       {
         FINROC_LOG_PRINT_STATIC(ERROR, e);
-        config_file.wrapped = rrlib::xml::tDocument();
-        try
-        {
-          config_file.wrapped.AddRootNode(cXML_BRANCH_NAME);
-        }
-        catch (const std::exception& e1)
-        {
-          FINROC_LOG_PRINT_STATIC(ERROR, e1);
-        }
       }
     }
-    config_file.filename = file;
   }
-  else if (config_file.active && content.length() > 0)
+  if (config_file.active && std::atomic_load(&config_file.published_snapshot))
   {
-    if (file.length() > 0)
-    {
-      config_file.filename = file;
-    }
-
-    try
-    {
-      config_file.wrapped = rrlib::xml::tDocument(content.c_str(), content.length() + 1);
-    }
-    catch (const std::exception& e)
-    {
-      FINROC_LOG_PRINT_STATIC(ERROR, e);
-    }
+    config_file.PublishSnapshot();
   }
 #endif
   return stream;
@@ -32,6 +32,15 @@
  * Configuration file.
  * Is an xml file consisting of a tree of nodes with values as leafs.
  *
+ * If a compiled version of the config file exists (see WriteCompiledFile())
+ * that was created from the current XML file, it is memory-mapped instead of parsing the XML file.
+ * The XML file is loaded when the document is needed (e.g. for modifying or saving).
+ *
+ * Flat config files (see internal::tFlatConfig) are plain text files that are loaded,
+ * modified and saved without any XML support (e.g. for minimal embedded builds).
+ *
+ * Receivers that already have a revision of the document can request only the entries changed since (see SerializeChanges()).
+ *
  */
 //----------------------------------------------------------------------
 #ifndef __plugins__parameters__tConfigFile_h__
@@ -42,10 +51,19 @@
 //----------------------------------------------------------------------
 #include "rrlib/serialization/serialization.h"
 #include "core/tFrameworkElement.h"
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
+#include <memory>
+#include <mutex>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/parameters/internal/tConfigBackend.h"
+#include "plugins/parameters/internal/tReadWriteLock.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -58,6 +76,12 @@ namespace parameters
 //----------------------------------------------------------------------
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
+namespace internal
+{
+class tConfigSnapshot;
+class tParameterInfo;
+class tStaticParameterList;
+}
 
 //----------------------------------------------------------------------
 // Class declaration
@@ -66,6 +90,34 @@ namespace parameters
 /*!
  * Configuration file.
  * Is an xml file consisting of a tree of nodes with values as leafs.
+ *
+ * If a compiled version of the config file exists (see WriteCompiledFile())
+ * that was created from the current XML file, it is memory-mapped instead of parsing the XML file.
+ * The XML file is loaded when the document is needed (e.g. for modifying or saving).
+ *
+ * Flat config files (see internal::tFlatConfig) are plain text files that are loaded,
+ * modified and saved without any XML support (e.g. for minimal embedded builds).
+ *
+ * Receivers that already have a revision of the document (e.g. tools synchronizing repeatedly) can request
+ * only the entries changed since that revision (see SerializeChanges()) - as long as the change log covers them.
+ * Otherwise, they receive the complete document. The document's lineage and revision are always transferred,
+ * so a receiving config file can request changes based on the revision it received next time.
+ * Changes are tracked for entries (re)created via GetEntry(entry, true). If XML nodes are modified
+ * differently, ForceFullSerialization() should be called.
+ * operator << and operator >> (e.g. used to synchronize with tools) use the same format: operator << transfers
+ * the entries changed since the revision last exchanged with the peer - or the complete document if the peer's revision
+ * is unknown. If operator >> receives changes that are based on a different revision, it ignores them - and the next
+ * operator << of the receiving config file transfers its complete document (so that both documents are the same again).
+ *
+ * Immutable snapshots of the config file's entries can be obtained via GetSnapshot().
+ * They can be read concurrently without any locking - and be used to roll back changes (see RestoreSnapshot()).
+ * Snapshots are copies of the entries' XML: parameters still load their values from the document (holding a shared lock),
+ * and restoring a snapshot writes the entries that differ back to the document.
+ *
+ * Config files have their own reader-writer lock: Values are looked up and deserialized
+ * (DeserializeEntry(), HasEntry(), GetStringEntry()) holding a shared lock only - without the runtime's structure mutex.
+ * All other operations modify the config file (or return XML nodes) and acquire the structure mutex and then an exclusive lock.
+ * XML nodes returned by GetEntry() and TryGetEntry() may only be accessed while holding the structure mutex.
  */
 class tConfigFile : public core::tAnnotation
 {
@@ -75,17 +127,96 @@ class tConfigFile : public core::tAnnotation
 //----------------------------------------------------------------------
 public:
 
+  /*! Entry that occurs more than once in config file (see GetDuplicateEntries()) */
+  struct tDuplicateEntry
+  {
+    /*! Qualified name of entry */
+    std::string entry;
+
+    /*! Number of 'node' and 'value' elements with this qualified name (lookups use the first one) */
+    size_t count;
+  };
+
   /*!
-   * \param filename File name of configuration file (loaded if it exists)
+   * \param filename File name of configuration file (loaded if it exists - as flat config file if it has the extension internal::tFlatConfig::cFILE_EXTENSION)
    * \param optional Is this an optional config file? (if false and specified file does not exists, prints a warning)
+   * \param lazy Load config file lazily? If true, the file is only pre-scanned for its top-level nodes.
+   *             A top-level node's subtree is parsed on the first lookup of an entry below it.
+   *             (comments between top-level nodes are not preserved when saving a lazily loaded config file)
+   */
+  tConfigFile(const std::string& filename, bool optional = false, bool lazy = false);
+
+  /*!
+   * Creates layered config file.
+   * Layers are merged into a single document on loading - with later layers overriding entries of earlier ones
+   * (e.g. base config, site-specific overrides, robot-specific overrides).
+   * Lookups therefore cost the same as with a single file.
+   * SaveFile() writes only to the top (last) layer - which receives all entries that differ from the layers below.
+   * On hot reload (see EnableHotReload()), all layers are merged again - but only the top layer is watched.
+   *
+   * \param layers File names of layers (base layer first - top layer last). Must not be empty.
+   * \param optional Are layers optional? (if false and a specified file does not exists, prints a warning)
+   *
+   * \throw Throws std::runtime_error if list of layers is empty
    */
-  tConfigFile(const std::string& filename, bool optional = false);
+  tConfigFile(const std::vector<std::string>& layers, bool optional = false);
 
   /*!
    * Create empty config file with no filename (should only be used to deserialize from stream)
    */
   tConfigFile();
 
+  ~tConfigFile();
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  /*!
+   * Deserializes changes (or complete document) written by SerializeChanges() of another config file.
+   * Changes are only applied if this config file has the revision they are based on.
+   *
+   * \param stream Stream to read from
+   * \return False if changes were not applied (then the complete document should be requested - passing lineage 0 to SerializeChanges())
+   */
+  bool DeserializeChanges(rrlib::serialization::tInputStream& stream);
+#endif
+
+  /*!
+   * Deserializes value of entry to specified object
+   * (works with XML document and compiled config files)
+   *
+   * \param entry Entry
+   * \param object Object to deserialize value to
+   * \return True if entry exists and value was deserialized. False if there is no such entry.
+   *
+   * \throw Throws any exceptions that occur during deserialization
+   */
+  bool DeserializeEntry(const std::string& entry, rrlib::rtti::tGenericObject& object);
+
+  /*!
+   * Stops watching config file for modifications (see EnableHotReload())
+   */
+  void DisableHotReload();
+
+  /*!
+   * Deserializes value of entry to specified object
+   * (variant with pre-tokenized path - does not allocate any memory to find entry)
+   *
+   * \param entry Path of entry
+   * \param object Object to deserialize value to
+   * \return True if entry exists and value was deserialized. False if there is no such entry.
+   *
+   * \throw Throws any exceptions that occur during deserialization
+   */
+  bool DeserializeEntry(const internal::tConfigPath& entry, rrlib::rtti::tGenericObject& object);
+
+  /*!
+   * Watches config file for modifications (using inotify).
+   * When the file is modified, it is reloaded - and only parameters whose config entries changed load their values again
+   * (without holding any lock on the config file). Files written by SaveFile() are not reloaded.
+   *
+   * \param debounce Period without further modifications after which file is reloaded (bursts of modifications cause a single reload)
+   */
+  void EnableHotReload(std::chrono::milliseconds debounce = std::chrono::milliseconds(200));
+
   /*!
    * Find ConfigFile which specified element is configured from
    *
@@ -94,6 +225,12 @@ public:
    */
   static tConfigFile* Find(const core::tFrameworkElement& element);
 
+  /*!
+   * Discards change log - so that all receivers obtain the complete document with their next request
+   * (e.g. when XML nodes were modified directly - see SerializeChanges())
+   */
+  void ForceFullSerialization();
+
 #ifdef _LIB_RRLIB_XML_PRESENT_
   /*!
    * Get entry from configuration file
@@ -106,21 +243,50 @@ public:
    */
   rrlib::xml::tNode& GetEntry(const std::string& entry, bool create = false);
 
+  /*!
+   * Get entry from configuration file
+   *
+   * \param entry Path of entry
+   * \param create (Re)create entry node?
+   * \return XMLNode representing entry
+   *
+   * \throw Throws std::runtime_error if entry cannot be found
+   */
+  rrlib::xml::tNode& GetEntry(const internal::tConfigPath& entry, bool create = false);
+
 
   /*!
    * Search entry in configuration file via an XML path
+   * (not const, as the complete XML document is created if it is not available yet - e.g. with compiled config files)
    *
    * \param path_to_entry XML path to locate the entry in this config file
    * \return XMLNode representing entry
    *
    * \throw Throws std::runtime_error if entry cannot be found
    */
-  const rrlib::xml::tNode& FindEntry(const std::string& path_to_entry) const
-  {
-    return wrapped.FindNode(path_to_entry);
-  }
+  const rrlib::xml::tNode& FindEntry(const std::string& path_to_entry);
+#endif
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  /*!
+   * Duplicate entries are detected when the entry index is built (a warning is printed once per entry).
+   * Lookups use the first entry (in document order).
+   *
+   * \return All entries that occur more than once in config file
+   */
+  std::vector<tDuplicateEntry> GetDuplicateEntries();
 #endif
 
+  /*!
+   * Computes fingerprint of entry's content
+   * (e.g. to determine whether an entry changed since its value was last deserialized)
+   *
+   * \param entry Path of entry
+   * \param fingerprint Fingerprint of entry's content (64 bit hash)
+   * \return True if entry exists. False if there is no such entry (fingerprint is not modified then).
+   */
+  bool GetEntryFingerprint(const internal::tConfigPath& entry, uint64_t& fingerprint);
+
   /*!
    * \return Filename of current config file
    */
@@ -136,6 +302,42 @@ public:
    */
   std::string GetStringEntry(const std::string& entry);
 
+  /*!
+   * \return Identifies history of revisions that document belongs to (see SerializeChanges())
+   */
+  uint64_t GetLineage() const
+  {
+    return lineage;
+  }
+
+  /*!
+   * \return Revision of config file's content (incremented whenever an entry is changed via GetEntry(entry, true))
+   */
+  uint64_t GetRevision() const
+  {
+    return revision;
+  }
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  /*!
+   * Obtains the snapshot of the config file's entries that was published most recently.
+   * Does not lock anything - unless no snapshot has been published yet (then one is published).
+   * Once snapshots are used, config file publishes a new one whenever it is saved, reloaded or received from a stream.
+   *
+   * \return Snapshot (immutable - may be read from any thread)
+   */
+  std::shared_ptr<const internal::tConfigSnapshot> GetSnapshot();
+#endif
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  /*!
+   * 'node' and 'value' elements without name are detected when the entry index is built (they are ignored by lookups).
+   *
+   * \return Qualified names of the parents of all such elements (empty string for top level)
+   */
+  std::vector<std::string> GetUnnamedEntries();
+#endif
+
   /*!
    * Does configuration file have the specified entry?
    *
@@ -144,6 +346,14 @@ public:
    */
   bool HasEntry(const std::string& entry);
 
+  /*!
+   * Does configuration file have the specified entry?
+   *
+   * \param entry Path of entry
+   * \return Answer
+   */
+  bool HasEntry(const internal::tConfigPath& entry);
+
   /*!
    * (Should only be used when Annotatable::getAnnotation() is called manually)
    *
@@ -154,33 +364,177 @@ public:
     return active;
   }
 
+  /*!
+   * \return Is a compiled config file currently used (instead of the XML document)?
+   */
+  bool IsCompiled() const
+  {
+    return backend && backend->GetKind() == internal::tConfigBackend::tKind::COMPILED;
+  }
+
+  /*!
+   * \return Is a flat config file currently used (instead of the XML document)?
+   * (in builds with XML support, the XML document is created from it when it is needed)
+   */
+  bool IsFlat() const
+  {
+    return backend && backend->GetKind() == internal::tConfigBackend::tKind::FLAT;
+  }
+
   /*!
    * set parameters of all child nodes to current values in tree
+   *
+   * \param force_publish Publish values even if ports already contain them? (by default, such no-op publishes are suppressed - so listeners are not notified)
    */
-  void LoadParameterValues();
+  void LoadParameterValues(bool force_publish = false);
 
   /*!
    * set parameters of all framework element's child nodes to current values in tree
    *
    * \param fe Framework element
+   * \param force_publish Publish values even if ports already contain them? (by default, such no-op publishes are suppressed - so listeners are not notified)
+   */
+  void LoadParameterValues(core::tFrameworkElement& fe, bool force_publish = false);
+
+  /*!
+   * Parses the specified config files in advance - concurrently on a pool of threads.
+   * Config files created later with one of these file names use the parsed documents
+   * (waiting for parsing to complete if necessary).
+   * Parameters are loaded exactly as without preloading.
+   *
+   * This should be called before the application's tree is constructed.
+   *
+   * \param filenames File names of config files (as passed to constructor)
+   * \param thread_count Number of threads to use (0 uses number of hardware threads)
+   */
+  static void Preload(const std::vector<std::string>& filenames, unsigned int thread_count = 0);
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  /*!
+   * Publishes snapshot of current entries (see GetSnapshot()).
+   * Only entries changed since the last published snapshot are copied - all others are shared with it.
+   * Should be called after entries were modified via GetEntry(entry, true).
+   * (must be called with runtime's structure mutex acquired - as any other modification)
    */
-  void LoadParameterValues(core::tFrameworkElement& fe);
+  void PublishSnapshot();
+
+  /*!
+   * Rolls config file back to the state of the specified snapshot.
+   * Only entries that differ from the current state are modified (shared subtrees are skipped) -
+   * and only parameters whose config entries changed load their values again.
+   * So the cost depends on the number of entries that differ (the document is not replaced in constant time).
+   * The snapshot is published as current snapshot.
+   * (must be called with runtime's structure mutex acquired)
+   *
+   * \param snapshot Snapshot obtained from this config file
+   */
+  void RestoreSnapshot(const std::shared_ptr<const internal::tConfigSnapshot>& snapshot);
+#endif
 
   /*!
    * Saves configuration file back to HDD
+   * (only parameters whose values changed since they were loaded or saved are written to tree.
+   *  The file is replaced atomically.)
    *
    * \param new_filename Name of file to save to (if empty, preserves current file name)
    */
   void SaveFile(const std::string& new_filename);
 
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  /*!
+   * Serializes changes since the specified revision - or complete document if the change log does not cover them
+   * (the receiver passes the lineage and revision of the document it has - see DeserializeChanges()).
+   * Does not modify config file.
+   *
+   * \param stream Stream to write to
+   * \param known_lineage Lineage of receiver's document (0 if receiver has no document yet)
+   * \param known_revision Revision of receiver's document
+   */
+  void SerializeChanges(rrlib::serialization::tOutputStream& stream, uint64_t known_lineage, uint64_t known_revision) const;
+#endif
+
+  /*!
+   * Serializes object to entry (entry is created if it does not exist)
+   * (works with XML document and flat config files)
+   * In XML documents, objects with a large binary form are stored base64-encoded (see SetBinaryValueThreshold()).
+   *
+   * \param entry Path of entry
+   * \param object Object to serialize
+   *
+   * \throw Throws std::runtime_error if config file cannot be modified (compiled config file without XML support)
+   */
+  void SerializeEntry(const internal::tConfigPath& entry, const rrlib::rtti::tGenericObject& object);
+
+  /*!
+   * Sets size of binary form (in bytes) from which SerializeEntry() stores values in XML documents
+   * in binary form (base64-encoded - see internal::tValueEncoding) instead of XML text.
+   * Binary values are much cheaper to load (e.g. no parsing of thousands of numbers from text).
+   * Applies to all config files (default is internal::tValueEncoding::cDEFAULT_BINARY_THRESHOLD).
+   *
+   * \param threshold Threshold in bytes (0 disables binary form)
+   */
+  static void SetBinaryValueThreshold(size_t threshold);
+
+  /*!
+   * Enables or disables the shared config cache for XML config files created afterwards (disabled by default).
+   * With the cache enabled, the first process on a host that loads an XML config file publishes a compiled
+   * image of it in shared memory - other processes loading the same (unmodified) file attach to this image
+   * read-only instead of parsing the file (see internal::tSharedConfigCache).
+   * Lazy loading is not used for files loaded with the cache enabled.
+   *
+   * \param enabled Whether to use the shared config cache
+   */
+  static void SetSharedCacheEnabled(bool enabled);
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  /*!
+   * Get entry from configuration file - without throwing an exception if it does not exist
+   *
+   * \param entry Entry
+   * \return XMLNode representing entry - or nullptr if there is no such entry (or it is no leaf)
+   */
+  rrlib::xml::tNode* TryGetEntry(const std::string& entry);
+
+  /*!
+   * Get entry from configuration file - without throwing an exception if it does not exist
+   *
+   * \param entry Path of entry
+   * \return XMLNode representing entry - or nullptr if there is no such entry (or it is no leaf)
+   */
+  rrlib::xml::tNode* TryGetEntry(const internal::tConfigPath& entry);
+
+  /*!
+   * Writes compiled version of this config file.
+   * If it is placed next to the XML file (file name + tCompiledConfig::cFILE_EXTENSION),
+   * it is used instead of the XML file when config file is loaded the next time -
+   * as long as the XML file's size and modification time match the ones recorded when compiling.
+   *
+   * \param file File to write compiled config file to
+   *
+   * \throw Throws std::runtime_error if writing fails
+   */
+  void WriteCompiledFile(const std::string& file);
+#endif
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
 private:
 
+  friend class internal::tParameterInfo;
+  friend class internal::tStaticParameterList;
   friend rrlib::serialization::tOutputStream& operator << (rrlib::serialization::tOutputStream& stream, const tConfigFile& file);
   friend rrlib::serialization::tInputStream& operator >> (rrlib::serialization::tInputStream& stream, tConfigFile& file);
 
+  /*! State shared with file watcher callback (defined in .cpp file) */
+  struct tHotReloadState;
+
+  /*! Values of parameters to load after config file was changed (defined in .cpp file) */
+  struct tPendingLoads;
+
+  /*! Acquires structure mutex and exclusive lock for modifying config file (defined in .cpp file) */
+  class tModificationLock;
+
 #ifdef _LIB_RRLIB_XML_PRESENT_
   /*! (Wrapped) XML document */
   rrlib::xml::tDocument wrapped;
@@ -192,25 +546,348 @@ private:
   /*! Is config file active? (false when config file is deleted via finstruct) */
   bool active;
 
+  /*! Backend (compiled or flat config file) - if one is used instead of XML document */
+  std::unique_ptr<internal::tConfigBackend> backend;
+
+  /*!
+   * Identifies history of revisions that document belongs to
+   * (changes when document received from another config file is modified locally)
+   */
+  uint64_t lineage;
+
+  /*! Lineage of revisions created by modifying this config file */
+  uint64_t own_lineage;
+
+  /*! Revision of document (within lineage) */
+  uint64_t revision;
+
+  /*! Changed entries with revision they were changed in (oldest first) */
+  std::deque<std::pair<uint64_t, internal::tConfigPath>> change_log;
+
+  /*! Change log contains all changes after this revision */
+  uint64_t change_log_start;
+
+  /*! Lineage and revision of document last exchanged via operator << or operator >> (lineage 0 if unknown) */
+  mutable std::pair<uint64_t, uint64_t> synced_revision;
+
+  /*! Mutex for synced_revision (operator << only holds shared lock) */
+  mutable std::mutex synced_revision_mutex;
+
+  /*! State shared with file watcher callback (null if hot reload is disabled) */
+  std::shared_ptr<tHotReloadState> hot_reload_state;
+
+  /*! Id of file watch (if hot reload is enabled) */
+  int hot_reload_watch;
+
+  /*! Snapshot that was published most recently (null if snapshots have not been used yet). Accessed atomically. */
+  std::shared_ptr<const internal::tConfigSnapshot> published_snapshot;
+
+  /*!
+   * Lock for accessing config file: shared for looking up and deserializing values - exclusive for modifications.
+   * Exclusive lock is only acquired via tModificationLock (after structure mutex).
+   */
+  mutable internal::tReadWriteLock access_lock;
+
+  /*!
+   * Incremented whenever config file is locked for modification (see tModificationLock).
+   * As long as it does not change, no entries change - so parameters need not check whether their entries changed.
+   */
+  std::atomic<uint64_t> modification_count;
+
+  /*! First parameter in registry of parameters that are configured from this config file (intrusive list) */
+  internal::tParameterInfo* first_registered_parameter;
+
+  /*! First list in registry of static parameter lists whose parameters are configured from this config file (intrusive list) */
+  internal::tStaticParameterList* first_registered_static_parameter_list;
+
+  /*! Generation of parameter bindings that registry was last updated for (see UpdateParameterRegistry()) */
+  int registry_generation;
+
 #ifdef _LIB_RRLIB_XML_PRESENT_
+  /*! Entry in entry index */
+  struct tIndexEntry
+  {
+    /*! First node (in document order) with qualified name */
+    rrlib::xml::tNode* node;
+
+    /*! Number of nodes in document with this qualified name */
+    size_t count;
+  };
+
+  /*!
+   * Index of all 'node' and 'value' elements in document.
+   * Key is path of element.
+   */
+  std::unordered_map<internal::tConfigPath, tIndexEntry> entry_index;
+
+  /*! Entries in entry index with count > 1 (in order of detection) */
+  std::vector<internal::tConfigPath> duplicate_entries;
+
+  /*! Duplicate entries that a warning has been printed for */
+  std::unordered_set<internal::tConfigPath> reported_duplicate_entries;
+
+  /*! Paths of parents of 'node' and 'value' elements without name (in order of detection) */
+  std::vector<internal::tConfigPath> unnamed_entries;
+
+  /*! Subtree of XML file that has not been parsed yet (lazy loading) */
+  struct tLazySubtree
+  {
+    /*! Byte range of subtree in XML file */
+    size_t offset, length;
+
+    /*! Placeholder node in document (nullptr after subtree has been parsed) */
+    rrlib::xml::tNode* placeholder;
+  };
+
+  /*! Content of XML file (only kept while there are lazy subtrees that have not been parsed yet) */
+  std::string lazy_xml;
+
+  /*! Top-level subtrees of lazily loaded XML file (in document order) */
+  std::vector<tLazySubtree> lazy_subtrees;
+
+  /*! First path segment of top-level node => indices of lazy subtrees with this segment that have not been parsed yet */
+  std::unordered_map<internal::tConfigPath::tSegment, std::vector<size_t>> lazy_subtree_index;
+
+  /*! File names of layers - if this is a layered config file (base layer first - last layer is 'filename') */
+  std::vector<std::string> layers;
+
+  /*! XML of all leaf entries in layers below top layer (entries with the same XML in the merged document are not saved to top layer) */
+  std::unordered_map<internal::tConfigPath, std::string> layer_base;
+
+  /*!
+   * Adds node and all of its child nodes to entry index - recursively
+   * (nodes that are no 'node' or 'value' elements are ignored)
+   *
+   * \param node Node to add
+   * \param entry Path of parent node (empty for root node). Temporarily extended during call.
+   */
+  void AddToEntryIndex(rrlib::xml::tNode& node, internal::tConfigPath& entry);
+
+  /*!
+   * Applies change of entry received from another config file
+   *
+   * \param entry Entry that changed
+   * \param xml XML of entry's new value node (nullptr if entry was removed)
+   */
+  void ApplyChange(const internal::tConfigPath& entry, const std::string* xml);
+
+  /*!
+   * Applies change of entry - copying the specified value node
+   *
+   * \param entry Entry that changed
+   * \param node Entry's new value node - possibly from another document (nullptr if entry was removed)
+   */
+  void ApplyChange(const internal::tConfigPath& entry, rrlib::xml::tNode* node);
+
+  /*!
+   * Discards any lazy subtrees (e.g. when document is replaced)
+   */
+  void ClearLazySubtrees();
+
   /*!
    * \param entry Config entry that created node should have
    * \param leaf Should created entry be a leaf node?
    * \return Returns or creates node with the specified config entry - possibly recursively
    */
-  rrlib::xml::tNode& CreateEntry(const std::string& entry, bool leaf);
+  rrlib::xml::tNode& CreateEntry(const internal::tConfigPath& entry, bool leaf);
 
   /*!
-   * Implementation of GetEntry() - called recursively
+   * Deserializes changes written by SerializeChanges() - after sender's lineage, revision and delta flag were read
    *
-   * \param result List that will contain the result(s) as additional entry/entries after the call
-   * \param entry Entry
-   * \param node Current node
-   * \param entry_string_index Current index in entry string
+   * \param stream Stream to read from
+   * \param sender_lineage Lineage of sender's document
+   * \param sender_revision Revision of sender's document
+   * \param apply Apply changes? (if false, they are only read from stream)
+   * \return True if changes were applied
+   */
+  bool DeserializeDelta(rrlib::serialization::tInputStream& stream, uint64_t sender_lineage, uint64_t sender_revision, bool apply);
+#endif
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  /*!
+   * \return XML of complete document (also if compiled config file is used or file is loaded lazily - without modifying anything)
+   */
+  std::string GetDocumentXML() const;
+#endif
+
+  /*!
+   * Records change of entry in change log (increments revision)
+   *
+   * \param entry Entry that changed
+   */
+  void EntryChanged(const internal::tConfigPath& entry);
+#ifdef _LIB_RRLIB_XML_PRESENT_
+
+  /*!
+   * \param entries Contains all leaf entries of XML document after call (text content or XML of value node)
+   * \param exclude Leaf entries whose XML equals the XML in this map are not added (optional)
+   */
+  void GetLeafEntries(std::vector<internal::tConfigBackend::tEntry>& entries, const std::unordered_map<internal::tConfigPath, std::string>* exclude = nullptr);
+
+  /*!
+   * Loads XML file lazily (see constructor)
+   *
+   * \param file XML file
+   * \return True if file was loaded. False if it cannot be loaded lazily (e.g. because it uses DTD entities or namespaces).
+   */
+  bool LoadLazily(const std::string& file);
+
+  /*!
+   * Loads and merges all layers of layered config file (see constructor)
+   * (replaces wrapped document - and entry index)
+   *
+   * \param optional Are layers optional? (if false and a specified file does not exists, prints a warning)
+   */
+  void LoadLayers(bool optional);
+
+  /*!
+   * Loads values of all parameters whose config entries are among the specified ones.
+   * Must be called with structure mutex acquired - but without exclusive lock on config file.
+   * Static parameters are loaded immediately. Sources of the other parameters' values are resolved -
+   * they are to be deserialized and published by the caller (preferably without holding the structure mutex - see tParameterInfo::LoadValues()).
+   *
+   * \param changed_entries Entries that changed
+   * \param pending_loads Pending loads of parameters whose values are to be loaded (appended)
+   */
+  void LoadChangedParameterValues(const std::unordered_set<internal::tConfigPath>& changed_entries, tPendingLoads& pending_loads);
+
+  /*!
+   * Looks up leaf entry in entry index (without parsing any lazy subtrees)
+   *
+   * \param entry Path of entry
+   * \return XMLNode representing entry - or nullptr if there is no such entry (or it is no leaf)
+   */
+  rrlib::xml::tNode* LookupEntry(const internal::tConfigPath& entry);
+#endif
+
+  /*!
+   * Marks values of all registered parameters as changed
+   * (so that they are written to tree on next save - e.g. after document has been replaced)
+   */
+  void MarkParameterValuesChanged();
+
+#ifdef _LIB_RRLIB_XML_PRESENT_
+  /*!
+   * Makes sure that complete XML document is loaded.
+   * If compiled config file is currently used, XML file is loaded - or document is reconstructed from compiled config file if there is no XML file.
+   * If XML file is loaded lazily, all subtrees that have not been parsed yet are parsed.
+   */
+  void MaterializeDocument();
+
+  /*!
+   * Parses lazy subtree and adds it to entry index
+   *
+   * \param index Index of lazy subtree
+   */
+  void MaterializeSubtree(size_t index);
+
+  /*!
+   * Parses all lazy subtrees that may contain the specified entry
+   *
+   * \param entry Path of entry
+   */
+  void MaterializeSubtrees(const internal::tConfigPath& entry);
+
+  /*!
+   * Calls function with node of leaf entry - holding a shared lock on config file
+   * (or exclusive access if entry's lazy subtrees need to be parsed first)
+   *
+   * \param entry Path of entry
+   * \param function Function to call with entry's node (nullptr if there is no such leaf entry)
+   * \return Return value of function
+   *
+   * \throw Throws tSubtreesNotParsed if entry's lazy subtrees need to be parsed on a thread that must not parse them
+   */
+  template <typename TResult, typename TFunction>
+  TResult ReadEntry(const internal::tConfigPath& entry, TFunction function);
+
+  /*! Thrown by ReadEntry() if entry's lazy subtrees need to be parsed on a thread that must not parse them (see parse_subtrees_forbidden) */
+  struct tSubtreesNotParsed {};
+
+  /*!
+   * Must the current thread not parse lazy subtrees?
+   * Set for threads deserializing values in tParameterInfo::LoadValues(): parsing requires the structure mutex -
+   * which the thread that started them may hold.
+   */
+  static thread_local bool parse_subtrees_forbidden;
+
+  /*!
+   * Reloads file after it was modified (see EnableHotReload()).
+   * Entries before reloading are taken from the current document or backend - so that changed entries are detected with any backend.
+   * Must be called with structure mutex acquired.
+   *
+   * \param pending_loads Pending loads of parameters whose config entries changed (to be loaded by caller - see LoadChangedParameterValues())
    */
-  void GetEntryImplementation(std::vector<rrlib::xml::tNode*>& result, const std::string& entry, rrlib::xml::tNode& node, size_t entry_string_index);
+  void ReloadFile(tPendingLoads& pending_loads);
+
+  /*!
+   * Replaces document (e.g. with document received from stream)
+   *
+   * \param document New document
+   * \param new_lineage Lineage of new document
+   * \param new_revision Revision of new document
+   */
+  void ReplaceDocument(rrlib::xml::tDocument && document, uint64_t new_lineage, uint64_t new_revision);
+
+  /*!
+   * Rebuilds entry index from wrapped XML document
+   * (must be called whenever document is replaced)
+   */
+  void RebuildEntryIndex();
 #endif
 
+  /*!
+   * Called whenever bindings of parameters to config files may have changed
+   * (e.g. a config file was created or (de)activated).
+   * Causes registries of all config files to be updated before they are used next time
+   * and invalidates cached config nodes (see tConfigNode).
+   */
+  static void InvalidateParameterRegistries();
+
+  /*!
+   * Adds parameter to registry of this config file
+   * (removes it from the registry of any other config file)
+   *
+   * \param parameter Parameter to add
+   */
+  void RegisterParameter(internal::tParameterInfo& parameter);
+
+  /*!
+   * Adds static parameter list to registry of this config file
+   * (removes it from the registry of any other config file)
+   *
+   * \param list Static parameter list to add
+   */
+  void RegisterStaticParameters(internal::tStaticParameterList& list);
+
+  /*!
+   * Removes parameter from registry of config file it is registered at (if any)
+   *
+   * \param parameter Parameter to remove
+   */
+  static void UnregisterParameter(internal::tParameterInfo& parameter);
+
+  /*!
+   * Removes static parameter list from registry of config file it is registered at (if any)
+   *
+   * \param list Static parameter list to remove
+   */
+  static void UnregisterStaticParameters(internal::tStaticParameterList& list);
+
+  /*!
+   * Starts new history of revisions (clears change log)
+   *
+   * \param new_lineage Lineage of history
+   * \param new_revision Current revision
+   */
+  void StartHistory(uint64_t new_lineage, uint64_t new_revision);
+
+  /*!
+   * Makes sure that parameter registry contains exactly the parameters (and static parameter lists) configured from this config file.
+   * Scans all elements below annotated element if parameter bindings may have changed since last update.
+   */
+  void UpdateParameterRegistry();
+
 };
 
 rrlib::serialization::tOutputStream& operator << (rrlib::serialization::tOutputStream& stream, const tConfigFile& file);
@@ -32,6 +32,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <atomic>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -60,19 +61,53 @@ namespace parameters
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
 
+/*! Caches path of config node to use for the framework element it is attached to */
+class tConfigNodeCache : public core::tAnnotation
+{
+public:
+
+  tConfigNodeCache() :
+    generation(-1),
+    path()
+  {}
+
+  /*! Generation of cached config nodes that path was determined in */
+  int generation;
+
+  /*! Cached path of config node */
+  internal::tConfigPath path;
+};
+
 //----------------------------------------------------------------------
 // Const values
 //----------------------------------------------------------------------
 
+/*! Generation of cached config nodes (incremented whenever cached config nodes may be outdated) */
+static std::atomic<int> cache_generation(0);
+
 //----------------------------------------------------------------------
 // Implementation
 //----------------------------------------------------------------------
 
 tConfigNode::tConfigNode(const std::string& node) :
-  node(node)
+  node(node),
+  node_path(node)
 {
 }
 
+void tConfigNode::AppendConfigNodes(core::tFrameworkElement& fe, const core::tFrameworkElement* config_file_element, internal::tConfigPath& result)
+{
+  tConfigNode* cn = fe.GetAnnotation<tConfigNode>();
+  if ((cn == NULL || (!cn->node_path.IsAbsolute())) && &fe != config_file_element && fe.GetParent())
+  {
+    AppendConfigNodes(*fe.GetParent(), config_file_element, result);
+  }
+  if (cn)
+  {
+    result.Append(cn->node_path);
+  }
+}
+
 std::string tConfigNode::GetConfigNode(core::tFrameworkElement& fe)
 {
   tConfigFile* cf = tConfigFile::Find(fe);
@@ -105,6 +140,36 @@ std::string tConfigNode::GetConfigNode(core::tFrameworkElement& fe)
   }
 }
 
+void tConfigNode::GetConfigNode(core::tFrameworkElement& fe, internal::tConfigPath& result)
+{
+  // Ports without config node or config file use the config node of their parent (so that all parameters of a module share one cache entry)
+  core::tFrameworkElement* element = &fe;
+  if (fe.IsPort() && fe.GetParent() && fe.GetAnnotation<tConfigNode>() == NULL && fe.GetAnnotation<tConfigFile>() == NULL)
+  {
+    element = fe.GetParent();
+  }
+
+  rrlib::thread::tLock lock(element->GetStructureMutex());
+  int generation = cache_generation;
+  tConfigNodeCache* cache = element->GetAnnotation<tConfigNodeCache>();
+  if (cache == NULL)
+  {
+    cache = new tConfigNodeCache();
+    element->AddAnnotation(*cache);
+  }
+  if (cache->generation != generation)
+  {
+    cache->path.Clear();
+    tConfigFile* cf = tConfigFile::Find(*element);
+    if (cf != NULL)
+    {
+      AppendConfigNodes(*element, cf->GetAnnotated<core::tFrameworkElement>(), cache->path);
+    }
+    cache->generation = generation;
+  }
+  result = cache->path;
+}
+
 std::string tConfigNode::GetFullConfigEntry(core::tFrameworkElement& parent, const std::string& config_entry)
 {
   if (config_entry[0] == '/')
@@ -115,6 +180,24 @@ std::string tConfigNode::GetFullConfigEntry(core::tFrameworkElement& parent, con
   return node + (((*node.rbegin()) == '/') ? "" : "/") + config_entry;
 }
 
+void tConfigNode::GetFullConfigEntry(core::tFrameworkElement& parent, const internal::tConfigPath& config_entry, internal::tConfigPath& result)
+{
+  if (config_entry.IsAbsolute())
+  {
+    result.Clear();
+  }
+  else
+  {
+    GetConfigNode(parent, result);
+  }
+  result.Append(config_entry);
+}
+
+void tConfigNode::InvalidateCachedConfigNodes()
+{
+  cache_generation++;
+}
+
 void tConfigNode::SetConfigNode(core::tFrameworkElement& fe, const std::string& node)
 {
   rrlib::thread::tLock lock(fe.GetStructureMutex());
@@ -126,12 +209,14 @@ void tConfigNode::SetConfigNode(core::tFrameworkElement& fe, const std::string&
       return;
     }
     cn->node = node;
+    cn->node_path = internal::tConfigPath(node);
   }
   else
   {
     cn = new tConfigNode(node);
     fe.AddAnnotation(*cn);
   }
+  InvalidateCachedConfigNodes();
 
   // reevaluate static parameters
   internal::tStaticParameterList::DoStaticParameterEvaluation(fe);
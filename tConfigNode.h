@@ -45,6 +45,7 @@
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/parameters/internal/tConfigPath.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -68,6 +69,7 @@ namespace parameters
  */
 class tConfigNode : public core::tAnnotation
 {
+  friend class tConfigFile;
 
 //----------------------------------------------------------------------
 // Public methods and typedefs
@@ -83,6 +85,18 @@ public:
    */
   static std::string GetConfigNode(core::tFrameworkElement& fe);
 
+  /*!
+   * Get config file node to use for the specified framework element - as pre-tokenized path
+   * (does not allocate any memory if result has sufficient capacity)
+   *
+   * The result is cached per framework element (ports without config node share the cache of their parent).
+   * Caches are invalidated by SetConfigNode() and whenever config files are created or (de)activated.
+   *
+   * \param fe Framework element
+   * \param result Contains path of config file node after call
+   */
+  static void GetConfigNode(core::tFrameworkElement& fe, internal::tConfigPath& result);
+
   /*!
    * Get full config entry for specified parent - taking any common config file node
    * stored in parents into account
@@ -93,6 +107,16 @@ public:
    */
   static std::string GetFullConfigEntry(core::tFrameworkElement& parent, const std::string& config_entry);
 
+  /*!
+   * Get full config entry for specified parent - as pre-tokenized path
+   * (does not allocate any memory if result has sufficient capacity)
+   *
+   * \param parent Parent framework element
+   * \param config_entry Config entry (relative to parent config file node - unless it is absolute)
+   * \param result Contains path of full config entry after call
+   */
+  static void GetFullConfigEntry(core::tFrameworkElement& parent, const internal::tConfigPath& config_entry, internal::tConfigPath& result);
+
   /*!
    * Set config file node for the specified framework element.
    *
@@ -109,8 +133,25 @@ private:
   /*! Config file entry for node (starting with '/' => absolute link - otherwise relative) */
   tString node;
 
+  /*! Config file entry for node as pre-tokenized path */
+  internal::tConfigPath node_path;
+
 
   tConfigNode(const std::string& node = "");
+
+  /*!
+   * Invalidates cached config nodes of all framework elements
+   */
+  static void InvalidateCachedConfigNodes();
+
+  /*!
+   * Appends paths of config nodes relevant for specified framework element to result - recursively
+   *
+   * \param fe Framework element
+   * \param config_file_element Framework element that config file is attached to
+   * \param result Path to append to
+   */
+  static void AppendConfigNodes(core::tFrameworkElement& fe, const core::tFrameworkElement* config_file_element, internal::tConfigPath& result);
 };
 
 //----------------------------------------------------------------------
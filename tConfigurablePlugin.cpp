@@ -38,6 +38,7 @@
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/parameters/internal/tFlatConfig.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -73,6 +74,37 @@ static std::string config_file_name;
 
 static bool first_plugin_initialized = false;
 
+/*!
+ * \return Flat config file for loading and configuring configurable plugins - if one was set and found. nullptr otherwise.
+ */
+static internal::tFlatConfig* GetFlatConfig()
+{
+  static std::unique_ptr<internal::tFlatConfig> flat_config;
+
+  // load config file?
+  if (config_file_name.length() && internal::tFlatConfig::IsFlatFile(config_file_name))
+  {
+    if (!core::FinrocFileExists(config_file_name))
+    {
+      FINROC_LOG_PRINT_STATIC(WARNING, "Configuration file '", config_file_name, "' does not exist. Plugins are initialized with defaults.");
+    }
+    else
+    {
+      try
+      {
+        flat_config.reset(new internal::tFlatConfig(core::GetFinrocFile(config_file_name)));
+      }
+      catch (const std::exception& e)
+      {
+        FINROC_LOG_PRINT_STATIC(ERROR, e);
+      }
+    }
+    config_file_name = "";
+  }
+
+  return flat_config.get();
+}
+
 tConfigurablePlugin::tConfigurablePlugin(const char* name) :
   tPlugin(name),
   initialized(false),
@@ -88,7 +120,7 @@ rrlib::xml::tNode* tConfigurablePlugin::GetConfigRootNode()
   static rrlib::xml::tNode* root_node = nullptr;
 
   // load config file?
-  if (config_file_name.length())
+  if (config_file_name.length() && (!internal::tFlatConfig::IsFlatFile(config_file_name)))  // flat config files are loaded by GetFlatConfig()
   {
     if (!core::FinrocFileExists(config_file_name))
     {
@@ -113,6 +145,18 @@ rrlib::xml::tNode* tConfigurablePlugin::GetConfigRootNode()
 }
 #endif
 
+bool tConfigurablePlugin::GetFlatParameterValue(const std::string& config_entry, std::string& value)
+{
+  internal::tFlatConfig* flat_config = GetFlatConfig();
+  internal::tConfigBackend::tValue entry_value;
+  if (flat_config && flat_config->Find(internal::tConfigPath(std::string(GetName()) + "/" + config_entry), entry_value) && (!entry_value.xml_fragment))
+  {
+    value = entry_value.ToString();
+    return true;
+  }
+  return false;
+}
+
 core::tFrameworkElement& tConfigurablePlugin::GetParameterElement()
 {
   if (!parameter_element)
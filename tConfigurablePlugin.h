@@ -142,12 +142,22 @@ public:
 
 #endif
 
+  /*!
+   * Returns value to get default parameter value from - if a flat config file was set (see SetConfigFile())
+   * and it contains an entry for the parameter. Entries are named '<plugin name>/<config entry>'.
+   *
+   * \param config_entry Config entry of parameter
+   * \param value Contains (text) value of entry after call - if one exists
+   * \return True if value for specified config entry exists
+   */
+  bool GetFlatParameterValue(const std::string& config_entry, std::string& value);
+
   /*!
    * Set configuration file to use for loading and configuring configurable plugins.
    * This must be called before tRuntimeEnvironment::GetInstance() to have an effect
    * (if configurable plugins were already initialized, a warning is displayed).
    *
-   * \param file_name File name of config file to use (loaded if it exists)
+   * \param file_name File name of config file to use (loaded if it exists - may be a flat config file, see internal::tFlatConfig)
    * \param root_node Path to node in config file that is the root node
    */
   static void SetConfigFile(const std::string& file_name);
@@ -255,6 +265,14 @@ private:
         Set(t);
       }
 #endif
+      std::string value;
+      if (this->plugin.GetFlatParameterValue(this->GetConfigEntry().length() ? this->GetConfigEntry() : this->GetName(), value))
+      {
+        T t;
+        rrlib::serialization::tStringInputStream stream(value);
+        stream >> t;
+        Set(t);
+      }
       this->SetConfigEntry("");
     }
   };
@@ -0,0 +1,127 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/tParameterTransaction.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/parameters/tParameterTransaction.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "core/port/tAbstractPort.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tParameterTransaction::tParameterTransaction(core::tFrameworkElement& element) :
+  element(element),
+  epoch(internal::tChangeEpoch::GetOrCreate(element)),
+  staged_values()
+{}
+
+tParameterTransaction::~tParameterTransaction()
+{}
+
+void tParameterTransaction::Commit()
+{
+  if (staged_values.empty())
+  {
+    return;
+  }
+
+  std::vector<internal::tChangeEpoch*> epochs = { &epoch };
+  for (tStagedValue & value : staged_values)
+  {
+    epochs.push_back(value.epoch);
+  }
+  {
+    internal::tChangeEpoch::tUpdate update(epochs);
+    for (tStagedValue & value : staged_values)
+    {
+      value.publish();
+    }
+  }
+  staged_values.clear();
+}
+
+void tParameterTransaction::Discard()
+{
+  staged_values.clear();
+}
+
+void tParameterTransaction::Stage(core::tAbstractPort& port, std::function<void()> publish)
+{
+  if (&port != &element && (!port.IsChildOf(element)))
+  {
+    throw std::runtime_error("Parameter '" + port.GetQualifiedName() + "' is not below framework element of transaction");
+  }
+  for (tStagedValue & value : staged_values)
+  {
+    if (value.port == &port)
+    {
+      value.publish = std::move(publish);
+      return;
+    }
+  }
+  staged_values.push_back(tStagedValue { &port, std::move(publish), internal::tChangeEpoch::Find(port) });
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
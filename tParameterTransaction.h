@@ -0,0 +1,263 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/tParameterTransaction.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tParameterTransaction
+ *
+ * \b tParameterTransaction
+ *
+ * Changes the values of multiple parameters atomically.
+ * Readers see either all of the changes or none of them.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__parameters__tParameterTransaction_h__
+#define __plugins__parameters__tParameterTransaction_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "core/tFrameworkElement.h"
+#include "plugins/data_ports/tGenericPort.h"
+#include "rrlib/util/tNoncopyable.h"
+#include <functional>
+#include <thread>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/parameters/tParameter.h"
+#include "plugins/parameters/internal/tChangeEpoch.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace parameters
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Atomic change of multiple parameters
+/*!
+ * A transaction begins on a framework element, such as a module or group.
+ * New values for parameters below this element are staged with Set().
+ * Commit() then publishes all of them within one change epoch of the element.
+ *
+ * Code that reads parameters below the element with ReadConsistently() never
+ * sees a half-applied set of values.
+ * GetChangeEpoch() increases once per commit. Checking it is cheaper than
+ * checking the changed flags of many parameters.
+ * Epoch listeners (see tEpoch::AddListener()) are notified once per commit - after all values were published.
+ * Port listeners are still notified once per changed port.
+ *
+ * Loading parameter values from config files (e.g. on hot reload) also publishes
+ * all loaded values within one change epoch.
+ *
+ * Looking up the change epoch of an element requires the structure mutex.
+ * Code that reads parameters frequently (e.g. in control loops) should therefore obtain
+ * the element's epoch once with GetEpoch() and pass it to GetChangeEpoch() and ReadConsistently().
+ *
+ * Staged values that are not committed are discarded when the transaction is destroyed.
+ */
+class tParameterTransaction : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Change epoch of framework element (listeners can be added - see internal::tChangeEpoch::tListener) */
+  typedef internal::tChangeEpoch tEpoch;
+
+  /*!
+   * Begins transaction
+   *
+   * \param element Framework element whose parameters are changed (change epoch is attached to this element)
+   */
+  explicit tParameterTransaction(core::tFrameworkElement& element);
+
+  ~tParameterTransaction();
+
+  /*!
+   * Publishes all staged values within a single change epoch.
+   * Afterwards, the transaction is empty and can be reused.
+   */
+  void Commit();
+
+  /*!
+   * Discards all staged values
+   */
+  void Discard();
+
+  /*!
+   * \param epoch Change epoch of framework element (see GetEpoch())
+   * \return Number of commits (and other multi-parameter updates) of parameters below element so far
+   */
+  static uint64_t GetChangeEpoch(const tEpoch& epoch)
+  {
+    return epoch.GetCounter() / 2;
+  }
+
+  /*!
+   * (looks up element's change epoch - acquiring the structure mutex; use overload with epoch in frequently executed code)
+   *
+   * \param element Framework element
+   * \return Number of commits (and other multi-parameter updates) of parameters below element so far
+   */
+  static uint64_t GetChangeEpoch(core::tFrameworkElement& element)
+  {
+    return GetChangeEpoch(GetEpoch(element));
+  }
+
+  /*!
+   * \param element Framework element that transactions begin on
+   * \return Change epoch of element (created if it does not exist yet - valid as long as element exists)
+   */
+  static tEpoch& GetEpoch(core::tFrameworkElement& element)
+  {
+    return internal::tChangeEpoch::GetOrCreate(element);
+  }
+
+  /*!
+   * Calls function to read parameters below element.
+   * The function is called again if a transaction was committed concurrently - so
+   * it should only read values (and have no side effects).
+   *
+   * If this is called by a thread that is committing values itself (e.g. from a port listener during Commit()),
+   * the function is called once - and reads the values of the commit in progress.
+   *
+   * \param epoch Change epoch of framework element that transactions begin on (see GetEpoch())
+   * \param function Function that reads parameters
+   */
+  template <typename TFunction>
+  static void ReadConsistently(const tEpoch& epoch, TFunction function)
+  {
+    while (true)
+    {
+      uint64_t counter = epoch.GetCounter();
+      if (counter % 2)
+      {
+        if (epoch.IsUpdatedByCurrentThread())
+        {
+          function();  // waiting for commit of this thread would never end
+          return;
+        }
+        std::this_thread::yield();  // commit in progress
+        continue;
+      }
+      function();
+      if (epoch.GetCounter() == counter)
+      {
+        return;
+      }
+    }
+  }
+
+  /*!
+   * (looks up element's change epoch - acquiring the structure mutex; use overload with epoch in frequently executed code)
+   *
+   * \param element Framework element that transactions begin on
+   * \param function Function that reads parameters
+   */
+  template <typename TFunction>
+  static void ReadConsistently(core::tFrameworkElement& element, TFunction function)
+  {
+    ReadConsistently(GetEpoch(element), function);
+  }
+
+  /*!
+   * Stages new value for parameter.
+   * If a value is already staged for the parameter, it is replaced.
+   *
+   * Values are published on commit exactly as with tParameter::Set()
+   * (converted to the port's data type - e.g. tNumber for numeric parameters).
+   *
+   * \param parameter Parameter (must be below the transaction's framework element)
+   * \param new_value New value of parameter
+   */
+  template <typename T>
+  void Set(tParameter<T>& parameter, const T& new_value)
+  {
+    tParameter<T> staged_parameter = parameter;
+    Stage(*parameter.GetWrapped(), [staged_parameter, new_value]() mutable
+    {
+      staged_parameter.Set(new_value);
+    });
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Staged value */
+  struct tStagedValue
+  {
+    /*! Port of parameter */
+    core::tAbstractPort* port;
+
+    /*! Publishes new value */
+    std::function<void()> publish;
+
+    /*! Change epoch of parameter's values (nearest to parameter) */
+    internal::tChangeEpoch* epoch;
+  };
+
+  /*! Framework element that transaction began on */
+  core::tFrameworkElement& element;
+
+  /*! Change epoch of this element */
+  internal::tChangeEpoch& epoch;
+
+  /*! Staged values (in order of staging) */
+  std::vector<tStagedValue> staged_values;
+
+
+  /*!
+   * Stages new value for port
+   *
+   * \param port Port of parameter
+   * \param publish Function that publishes new value
+   */
+  void Stage(core::tAbstractPort& port, std::function<void()> publish);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,172 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/tools/benchmark_lookup/main.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * Benchmark of config entry lookup on the parameter load path.
+ *
+ * Measures the cost of looking up the config entries of a set of parameters -
+ * depending on the share of parameters that have no entry in the config file:
+ *  - exception-based: HasEntry() implemented via GetEntry() and catching std::runtime_error,
+ *                     followed by a second GetEntry() to load the value (as before TryGetEntry() existed)
+ *  - TryGetEntry():   single non-throwing lookup
+ *
+ * Usage: finroc_parameters_benchmark_lookup [<number of parameters>] [<repetitions>]
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/parameters/tConfigFile.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace finroc::parameters;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Shares of parameters without config entry (in percent) */
+static const int cMISSING_SHARES[] = { 0, 10, 25, 50, 75, 100 };
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * \param index Index of parameter
+ * \return Config entry of parameter (entries of 16 parameters share one module node)
+ */
+static std::string EntryName(size_t index)
+{
+  return "Module" + std::to_string(index / 16) + "/Parameters/Parameter" + std::to_string(index % 16);
+}
+
+/*!
+ * Measures time required to execute function
+ *
+ * \param repetitions Number of times to execute function
+ * \param function Function to execute
+ * \return Average duration in nanoseconds
+ */
+template <typename TFunction>
+static double Measure(size_t repetitions, TFunction function)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < repetitions; i++)
+  {
+    function();
+  }
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / repetitions;
+}
+
+int main(int argc, char** argv)
+{
+  size_t parameter_count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+  size_t repetitions = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10;
+  if (parameter_count == 0 || repetitions == 0)
+  {
+    std::cerr << "Usage: " << argv[0] << " [<number of parameters>] [<repetitions>]" << std::endl;
+    return 2;
+  }
+
+  std::vector<std::string> entries;
+  for (size_t i = 0; i < parameter_count; i++)
+  {
+    entries.push_back(EntryName(i));
+  }
+
+  std::cout << "Parameters: " << parameter_count << " (average of " << repetitions << " runs)" << std::endl;
+  std::cout << std::setw(10) << "missing" << std::setw(22) << "exception-based [ms]" << std::setw(20) << "TryGetEntry [ms]" << std::setw(10) << "speedup" << std::endl;
+  for (int missing_share : cMISSING_SHARES)
+  {
+    // every n-th parameter has no entry (spread evenly across document)
+    tConfigFile config_file;
+    size_t missing = 0;
+    for (size_t i = 0; i < parameter_count; i++)
+    {
+      if ((i * missing_share) / 100 != ((i + 1) * missing_share) / 100)
+      {
+        missing++;
+        continue;
+      }
+      config_file.GetEntry(entries[i], true).SetContent("1.5");
+    }
+
+    size_t found_exception_based = 0, found_try_get_entry = 0;
+    double exception_based = Measure(repetitions, [&]()
+    {
+      for (auto & entry : entries)
+      {
+        try
+        {
+          config_file.GetEntry(entry);  // HasEntry()
+          found_exception_based += config_file.GetEntry(entry).GetTextContent().length() ? 1 : 0;  // LoadValue()
+        }
+        catch (const std::runtime_error&)
+        {
+        }
+      }
+    });
+    double try_get_entry = Measure(repetitions, [&]()
+    {
+      for (auto & entry : entries)
+      {
+        rrlib::xml::tNode* node = config_file.TryGetEntry(entry);
+        found_try_get_entry += (node && node->GetTextContent().length()) ? 1 : 0;
+      }
+    });
+    if (found_exception_based != found_try_get_entry || found_try_get_entry != (parameter_count - missing) * repetitions)
+    {
+      std::cerr << "Lookup results differ" << std::endl;
+      return 1;
+    }
+
+    std::cout << std::setw(9) << (100 * missing / parameter_count) << "%" << std::fixed << std::setprecision(3) << std::setw(22) << (exception_based / 1000000.0) <<
+              std::setw(20) << (try_get_entry / 1000000.0) << std::setprecision(2) << std::setw(9) << (exception_based / try_get_entry) << "x" << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,169 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/tools/benchmark_numeric_parsing/main.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * Benchmark of numeric value parsing on the parameter load path.
+ *
+ * Measures the cost of deserializing values of numeric parameters from strings
+ * (command line options, finstruct defaults, flat config files):
+ *  - generic:             rrlib::serialization::tStringInputStream and tGenericObject::Deserialize()
+ *  - tNumericValueParser: fast path for plain values of built-in numeric types and tNumber
+ *
+ * Both paths must yield equal values - otherwise the benchmark fails.
+ *
+ * Usage: finroc_parameters_benchmark_numeric_parsing [<number of values>] [<repetitions>]
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include "rrlib/serialization/serialization.h"
+#include "plugins/data_ports/numeric/tNumber.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/parameters/internal/tNumericValueParser.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace finroc::parameters;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Benchmarked type and function that creates its n-th value as string */
+struct tBenchmarkedType
+{
+  rrlib::rtti::tType type;
+  std::string (*value)(size_t index);
+};
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Benchmarked types */
+static const tBenchmarkedType cTYPES[] =
+{
+  { rrlib::rtti::tDataType<double>(), [](size_t index) { return std::to_string(index) + "." + std::to_string(index % 1000) + "e-3"; } },
+  { rrlib::rtti::tDataType<float>(), [](size_t index) { return "-" + std::to_string(index % 10000) + ".25"; } },
+  { rrlib::rtti::tDataType<int>(), [](size_t index) { return std::to_string(static_cast<int>(index) - 5000); } },
+  { rrlib::rtti::tDataType<unsigned int>(), [](size_t index) { return std::to_string(index * 7); } },
+  { rrlib::rtti::tDataType<bool>(), [](size_t index) { return std::string(index % 2 ? "true" : "false"); } },
+  { rrlib::rtti::tDataType<finroc::data_ports::numeric::tNumber>(), [](size_t index) { return index % 2 ? std::to_string(index) + ".5" : std::to_string(index); } }
+};
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * Measures time required to execute function
+ *
+ * \param repetitions Number of times to execute function
+ * \param function Function to execute
+ * \return Average duration in nanoseconds
+ */
+template <typename TFunction>
+static double Measure(size_t repetitions, TFunction function)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < repetitions; i++)
+  {
+    function();
+  }
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / repetitions;
+}
+
+int main(int argc, char** argv)
+{
+  size_t value_count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+  size_t repetitions = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10;
+  if (value_count == 0 || repetitions == 0)
+  {
+    std::cerr << "Usage: " << argv[0] << " [<number of values>] [<repetitions>]" << std::endl;
+    return 2;
+  }
+
+  std::cout << "Values: " << value_count << " (average of " << repetitions << " runs)" << std::endl;
+  std::cout << std::setw(14) << "type" << std::setw(14) << "generic [ms]" << std::setw(18) << "fast path [ms]" << std::setw(10) << "speedup" << std::endl;
+  for (const tBenchmarkedType & benchmarked_type : cTYPES)
+  {
+    std::vector<std::string> values;
+    for (size_t i = 0; i < value_count; i++)
+    {
+      values.push_back(benchmarked_type.value(i));
+    }
+    std::unique_ptr<rrlib::rtti::tGenericObject> generic_object(benchmarked_type.type.CreateInstanceGeneric());
+    std::unique_ptr<rrlib::rtti::tGenericObject> fast_path_object(benchmarked_type.type.CreateInstanceGeneric());
+
+    // check that both paths yield equal values
+    for (auto & value : values)
+    {
+      rrlib::serialization::tStringInputStream stream(value);
+      generic_object->Deserialize(stream);
+      if ((!internal::tNumericValueParser::TryParse(value, *fast_path_object)) || (!generic_object->Equals(*fast_path_object)))
+      {
+        std::cerr << "Values of type " << benchmarked_type.type.GetName() << " differ for '" << value << "'" << std::endl;
+        return 1;
+      }
+    }
+
+    double generic = Measure(repetitions, [&]()
+    {
+      for (auto & value : values)
+      {
+        rrlib::serialization::tStringInputStream stream(value);
+        generic_object->Deserialize(stream);
+      }
+    });
+    double fast_path = Measure(repetitions, [&]()
+    {
+      for (auto & value : values)
+      {
+        internal::tNumericValueParser::Deserialize(value, *fast_path_object);
+      }
+    });
+
+    std::cout << std::setw(14) << benchmarked_type.type.GetName() << std::fixed << std::setprecision(3) << std::setw(14) << (generic / 1000000.0) <<
+              std::setw(18) << (fast_path / 1000000.0) << std::setprecision(2) << std::setw(9) << (generic / fast_path) << "x" << std::endl;
+  }
+  return 0;
+}
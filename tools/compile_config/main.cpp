@@ -0,0 +1,175 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/tools/compile_config/main.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * Offline tool that validates config files and optionally compiles them.
+ *
+ * Config files are loaded exactly as tConfigFile does at application startup.
+ * Parse errors, duplicate entries, and 'node'/'value' elements without name are reported -
+ * so that they are detected at build time rather than on the robot.
+ *
+ * Usage: finroc_compile_config [-o <compiled file>] <config file> [<layer> ...]
+ *
+ * With multiple files, they are merged as layers (see tConfigFile).
+ * The compiled file is only written if no problems were found.
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <iostream>
+#include "rrlib/xml/tDocument.h"
+#include "core/file_lookup.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/parameters/tConfigFile.h"
+#include "plugins/parameters/internal/tFlatConfig.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace finroc::parameters;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * Prints usage information
+ *
+ * \param program Name of program
+ */
+static void PrintUsage(const char* program)
+{
+  std::cerr << "Usage: " << program << " [-o <compiled file>] <config file> [<layer> ...]" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  std::string compiled_file;
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; i++)
+  {
+    std::string argument = argv[i];
+    if (argument == "-o" && i + 1 < argc)
+    {
+      compiled_file = argv[++i];
+    }
+    else if (argument.length() && argument[0] == '-')
+    {
+      PrintUsage(argv[0]);
+      return 2;
+    }
+    else
+    {
+      files.push_back(argument);
+    }
+  }
+  if (files.empty())
+  {
+    PrintUsage(argv[0]);
+    return 2;
+  }
+
+  // parse errors (tConfigFile only logs them)
+  bool valid = true;
+  for (auto & file : files)
+  {
+    if (!finroc::core::FinrocFileExists(file))
+    {
+      std::cerr << file << ": file not found" << std::endl;
+      valid = false;
+      continue;
+    }
+    try
+    {
+      if (!internal::tFlatConfig::IsFlatFile(file))
+      {
+        finroc::core::GetFinrocXMLDocument(file, false);
+      }
+      else
+      {
+        internal::tFlatConfig flat_file(finroc::core::GetFinrocFile(file));
+      }
+    }
+    catch (const std::exception& e)
+    {
+      std::cerr << file << ": " << e.what() << std::endl;
+      valid = false;
+    }
+  }
+  if (!valid)
+  {
+    return 1;
+  }
+
+  // layered config file is always loaded from XML (never from compiled files)
+  tConfigFile config_file(files);
+  for (auto & entry : config_file.GetDuplicateEntries())
+  {
+    std::cerr << config_file.GetFilename() << ": entry '" << entry.entry << "' occurs " << entry.count << " times" << std::endl;
+    valid = false;
+  }
+  for (auto & parent : config_file.GetUnnamedEntries())
+  {
+    std::cerr << config_file.GetFilename() << ": element without name in '" << (parent.length() ? parent : "/") << "'" << std::endl;
+    valid = false;
+  }
+  if (!valid)
+  {
+    return 1;
+  }
+
+  if (compiled_file.length())
+  {
+    try
+    {
+      config_file.WriteCompiledFile(compiled_file);
+    }
+    catch (const std::exception& e)
+    {
+      std::cerr << compiled_file << ": " << e.what() << std::endl;
+      return 1;
+    }
+  }
+  return 0;
+}
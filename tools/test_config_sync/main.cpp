@@ -0,0 +1,155 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/parameters/tools/test_config_sync/main.cpp
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-16
+ *
+ * Test of synchronizing config files via operator << and operator >>.
+ *
+ * Checks that
+ *  - a config file without document receives the complete document
+ *  - changes (modified and removed entries) are applied to the receiver's document in place
+ *  - changes based on a different lineage are ignored - and the receiver transfers its complete document next time
+ *
+ * Usage: finroc_parameters_test_config_sync
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <iostream>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/parameters/tConfigFile.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace finroc::parameters;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*! Number of failed checks */
+static int failed_checks = 0;
+
+/*!
+ * \param condition Condition that should be true
+ * \param description Description of check (printed if it fails)
+ */
+static void Check(bool condition, const std::string& description)
+{
+  if (!condition)
+  {
+    std::cerr << "FAILED: " << description << std::endl;
+    failed_checks++;
+  }
+}
+
+/*!
+ * \param config_file Config file
+ * \param entry Config entry
+ * \return Content of entry (empty string if entry does not exist)
+ */
+static std::string Content(tConfigFile& config_file, const std::string& entry)
+{
+  rrlib::xml::tNode* node = config_file.TryGetEntry(entry);
+  return node ? node->GetTextContent() : std::string();
+}
+
+/*!
+ * Transfers config file to another config file via streams (as when synchronizing with a tool)
+ *
+ * \param source Config file to serialize
+ * \param destination Config file to deserialize into
+ */
+static void Transfer(const tConfigFile& source, tConfigFile& destination)
+{
+  rrlib::serialization::tMemoryBuffer buffer;
+  rrlib::serialization::tOutputStream output(buffer);
+  output << source;
+  output.Close();
+  rrlib::serialization::tInputStream input(buffer);
+  input >> destination;
+}
+
+int main(int argc, char** argv)
+{
+  tConfigFile runtime;
+  runtime.GetEntry("Module/x", true).SetContent("1");
+  runtime.GetEntry("Module/z", true).SetContent("3");
+  std::shared_ptr<const internal::tConfigSnapshot> without_y = runtime.GetSnapshot();
+  runtime.GetEntry("Module/y", true).SetContent("2");
+
+  // Receiver without document obtains complete document
+  tConfigFile tool;
+  Transfer(runtime, tool);
+  Check(Content(tool, "Module/x") == "1" && Content(tool, "Module/y") == "2" && Content(tool, "Module/z") == "3", "complete document is transferred");
+  Check(tool.GetLineage() == runtime.GetLineage() && tool.GetRevision() == runtime.GetRevision(), "receiver has sender's revision");
+
+  // Changes are applied in place (unchanged nodes are kept)
+  rrlib::xml::tNode* unchanged_node = tool.TryGetEntry("Module/z");
+  runtime.RestoreSnapshot(without_y);
+  runtime.GetEntry("Module/x", true).SetContent("10");
+  Transfer(runtime, tool);
+  Check(Content(tool, "Module/x") == "10", "modified entry is applied");
+  Check(tool.TryGetEntry("Module/y") == nullptr, "removed entry is removed");
+  Check(tool.TryGetEntry("Module/z") == unchanged_node, "changes are applied in place");
+  Check(tool.GetLineage() == runtime.GetLineage() && tool.GetRevision() == runtime.GetRevision(), "receiver has sender's revision after changes");
+
+  // Changes based on a different lineage are ignored - receiver transfers complete document next time
+  tool.GetEntry("Module/z", true).SetContent("local");
+  Check(tool.GetLineage() != runtime.GetLineage(), "local modification starts new lineage");
+  runtime.GetEntry("Module/x", true).SetContent("20");
+  Transfer(runtime, tool);
+  Check(Content(tool, "Module/x") == "10" && Content(tool, "Module/z") == "local", "changes based on different lineage are ignored");
+  Transfer(tool, runtime);
+  Check(Content(runtime, "Module/x") == "10" && Content(runtime, "Module/z") == "local" && runtime.TryGetEntry("Module/y") == nullptr, "complete document is transferred after lineage mismatch");
+  Check(tool.GetLineage() == runtime.GetLineage() && tool.GetRevision() == runtime.GetRevision(), "sender's revision is received after lineage mismatch");
+
+  if (failed_checks)
+  {
+    std::cerr << failed_checks << " check(s) failed" << std::endl;
+    return 1;
+  }
+  std::cout << "All checks passed" << std::endl;
+  return 0;
+}